@@ -0,0 +1,229 @@
+/**
+ * @file Arena.hpp
+ * @brief Declaration of monotonic arena allocator
+ *
+ * @version 1.0.0
+ * @authors Eugene Azimut
+ * @copyright Copyright (c) Eugene Azimut, 2026
+ */
+#pragma once
+#include "api.hpp"
+
+#include <cstddef>
+#include <type_traits>
+
+
+
+namespace argparse {
+    /**
+     * @class Arena
+     * @brief Monotonic arena allocator
+     * @details Hands out memory by bumping a pointer inside a block.
+     * When the block is exhausted a new one (at least twice as large) is chained.
+     * Individual allocations are never freed: all of them are released together
+     * by Arena::reset() or by the destructor.\n
+     * Arena::reset() keeps a single block large enough for everything allocated before,
+     * so a workload of the same size is served from one block without touching the heap
+     *
+     * @note Only trivially destructible objects should be placed in the arena:
+     * destructors aren't invoked
+     *
+     * @version 1.0.0
+     * @authors Eugene Azimut
+     */
+    ARGPARSE_API class Arena {
+    public:
+        /**
+         * @brief Default size of the first block in bytes
+         *
+         * @version 1.0.0
+         * @authors Eugene Azimut
+         */
+        static constexpr size_t DEFAULT_BLOCK_SIZE = 4096;
+
+    //* Ctors and dtor
+        /**
+         * @brief Default constructor
+         * @details Creates an empty arena. Nothing is allocated until first use
+         *
+         * @param[in] BlockSize Size of the first block in bytes
+         *
+         * @version 1.0.0
+         * @authors Eugene Azimut
+         */
+        explicit Arena(size_t BlockSize = DEFAULT_BLOCK_SIZE);
+
+        /**
+         * @brief Copying is prohibited: memory handed out by an arena belongs to it
+         *
+         * @version 1.0.0
+         * @authors Eugene Azimut
+         */
+        Arena(const Arena &Other) = delete;
+
+        /**
+         * @brief Move constructor
+         * @details Takes over all blocks of Other. Other becomes empty
+         *
+         * @param[in] Other Instance to move
+         *
+         * @version 1.0.0
+         * @authors Eugene Azimut
+         */
+        Arena(Arena &&Other) noexcept;
+
+        /**
+         * @brief Releases all blocks
+         *
+         * @version 1.0.0
+         * @authors Eugene Azimut
+         */
+        virtual ~Arena() noexcept;
+
+    //* Operators
+        /**
+         * @brief Copying is prohibited: memory handed out by an arena belongs to it
+         *
+         * @version 1.0.0
+         * @authors Eugene Azimut
+         */
+        Arena &operator=(const Arena &Other) = delete;
+
+        /**
+         * @brief Move assignment operator
+         * @details Releases own blocks and takes over all blocks of Other
+         *
+         * @param[in] Other Instance to move
+         * @return Reference to this arena
+         *
+         * @version 1.0.0
+         * @authors Eugene Azimut
+         */
+        Arena &operator=(Arena &&Other) noexcept;
+
+    //* Getters and setters
+        /**
+         * @brief Get size of the first block
+         * @return Size in bytes
+         *
+         * @version 1.0.0
+         * @authors Eugene Azimut
+         */
+        size_t getBlockSize() const;
+
+        /**
+         * @brief Set size of the first block
+         * @details Takes effect when the next block is allocated
+         *
+         * @param[in] BlockSize Size in bytes
+         *
+         * @version 1.0.0
+         * @authors Eugene Azimut
+         */
+        void setBlockSize(size_t BlockSize);
+
+        /**
+         * @brief Returns number of bytes handed out since the last reset
+         * @return Number of bytes including alignment padding
+         *
+         * @version 1.0.0
+         * @authors Eugene Azimut
+         */
+        size_t getUsed() const;
+
+        /**
+         * @brief Returns total size of owned blocks
+         * @return Number of bytes
+         *
+         * @version 1.0.0
+         * @authors Eugene Azimut
+         */
+        size_t getCapacity() const;
+
+    //* etc
+        /**
+         * @brief Allocates Size bytes aligned to Align
+         * @param[in] Size Number of bytes
+         * @param[in] Align Alignment. Must be a power of two
+         * @return Pointer to uninitialized memory
+         *
+         * @throw std::bad_alloc in case of memory allocation failure
+         *
+         * @version 1.0.0
+         * @authors Eugene Azimut
+         */
+        void *allocate(size_t Size, size_t Align = alignof(std::max_align_t));
+
+        /**
+         * @brief Allocates uninitialized array of Count objects of type T
+         * @tparam T Trivially destructible type
+         * @param[in] Count Number of objects
+         * @return Pointer to the first object
+         *
+         * @throw std::bad_alloc in case of memory allocation failure
+         *
+         * @version 1.0.0
+         * @authors Eugene Azimut
+         */
+        template<typename T>
+        T *allocateArray(size_t Count) {
+            static_assert(
+                std::is_trivially_destructible<T>::value,
+                "Arena doesn't invoke destructors"
+            );
+            return static_cast<T *>(allocate(sizeof(T) * Count, alignof(T)));
+        }
+
+        /**
+         * @brief Releases everything allocated at once
+         * @details Keeps one block whose size is enough for everything
+         * allocated since the previous reset, other blocks are freed
+         *
+         * @throw std::bad_alloc in case of memory allocation failure
+         *
+         * @version 1.0.0
+         * @authors Eugene Azimut
+         */
+        void reset();
+
+    private:
+        /**
+         * @struct Block
+         * @brief Header of arena block. Data follows the header
+         *
+         * @version 1.0.0
+         * @authors Eugene Azimut
+         */
+        struct Block {
+            Block *Prev;    ///< Previously allocated block
+            size_t Size;    ///< Size of data in bytes
+        };
+
+        /**
+         * @brief Chains new block that fits at least MinSize bytes
+         * @param[in] MinSize Minimum size of data in bytes
+         *
+         * @throw std::bad_alloc in case of memory allocation failure
+         *
+         * @version 1.0.0
+         * @authors Eugene Azimut
+         */
+        void grow(size_t MinSize);
+
+        /**
+         * @brief Frees all blocks
+         *
+         * @version 1.0.0
+         * @authors Eugene Azimut
+         */
+        void release() noexcept;
+
+    //* Variables
+        Block *mHead;           ///< Current (last allocated) block
+        char  *mCursor;         ///< First free byte of current block
+        char  *mEnd;            ///< End of current block
+        size_t mBlockSize;      ///< Size of the first block
+        size_t mUsed;           ///< Bytes handed out since last reset
+        size_t mCapacity;       ///< Total size of blocks
+    };
+}
@@ -0,0 +1,122 @@
+/**
+ * @file ArgparseError.hpp
+ * @brief Declaration of non-throwing parsing errors
+ *
+ * @version 1.0.0
+ * @authors Eugene Azimut
+ * @copyright Copyright (c) Eugene Azimut, 2026
+ */
+#pragma once
+#include "api.hpp"
+#include "StringView.hpp"
+
+#include <cstdint>
+
+
+
+namespace argparse {
+    /**
+     * @brief Error codes reported by non-throwing API
+     * @details Values:\n
+     * * "SUCCESS"                  - no error\n
+     * * "NOT_AN_OPTION"            - argument isn't an option, e.g. "file.txt"\n
+     * * "OPTION_NOT_PROVIDED"      - indicator without option, e.g. "-" or "--=value"\n
+     * * "DELIMITER_AS_OPTION"      - value delimiter in place of option, e.g. "--=" or "-="\n
+     * * "SHORT_OPTION_DELIMITER"   - value delimiter in short option, e.g. "-f=value"\n
+     * * "UNRECOGNIZED_OPTION"      - option isn't registered\n
+     * * "UNRECOGNIZED_ARGUMENT"    - argument can't be consumed by any registered argument\n
+     * * "UNEXPECTED_VALUE"         - value attached to option which doesn't accept values\n
+     * * "EXPECTED_MORE_VALUES"     - option got less values than required\n
+     * * "RESPONSE_FILE_UNREADABLE" - response file can't be opened or mapped\n
+     * * "RESPONSE_FILE_QUOTE"      - unterminated quote in response file\n
+     * * "RESPONSE_FILE_DEPTH"      - response files are nested too deeply\n
+     * * "AMBIGUOUS_OPTION"         - abbreviated option matches several arguments\n
+     * * "CONFIG_FILE_UNREADABLE"   - existing config file can't be opened or mapped\n
+     * * "CONFIG_FILE_SYNTAX"       - line of config file is neither "key = value", "key", "[section]" nor comment\n
+     * * "UNRECOGNIZED_CONFIG_KEY"  - key of config file doesn't match any registered flag\n
+     * * "MISSING_REQUIRED_OPTION"  - required argument was given neither on the command line,
+     *   nor in the environment or config file\n
+     * * "EXCLUSIVE_OPTIONS"        - several arguments of a mutually exclusive group were given\n
+     * * "MISSING_GROUP_OPTION"     - no argument of a group requiring one was given\n
+     * * "MISSING_DEPENDENCY"       - argument was given without an argument it requires\n
+     * * "INVALID_OPTION"           - UnixStyle indicator without option, e.g. "-", "--=value" or "--" split as an option\n
+     * * "INVALID_VALUE"            - value can't be converted to the argument type, e.g. "abc" for a number\n
+     * * "VALUE_OUT_OF_RANGE"       - value doesn't fit the argument type or its range of accepted values
+     *
+     * @version 1.0.0
+     * @authors Eugene Azimut
+     */
+    ARGPARSE_API enum ErrorCode: uint8_t {
+        SUCCESS                     = 0u,   ///< No error
+        NOT_AN_OPTION               = 1u,   ///< Argument isn't an option
+        OPTION_NOT_PROVIDED         = 2u,   ///< Indicator without option
+        DELIMITER_AS_OPTION         = 3u,   ///< Value delimiter in place of option
+        SHORT_OPTION_DELIMITER      = 4u,   ///< Value delimiter in short option
+        UNRECOGNIZED_OPTION         = 5u,   ///< Option isn't registered
+        UNRECOGNIZED_ARGUMENT       = 6u,   ///< Argument can't be consumed
+        UNEXPECTED_VALUE            = 7u,   ///< Option doesn't accept values
+        EXPECTED_MORE_VALUES        = 8u,   ///< Option got less values than required
+        RESPONSE_FILE_UNREADABLE    = 9u,   ///< Response file can't be read
+        RESPONSE_FILE_QUOTE         = 10u,  ///< Unterminated quote in response file
+        RESPONSE_FILE_DEPTH         = 11u,  ///< Response files are nested too deeply
+        AMBIGUOUS_OPTION            = 12u,  ///< Abbreviated option matches several arguments
+        CONFIG_FILE_UNREADABLE      = 13u,  ///< Config file can't be read
+        CONFIG_FILE_SYNTAX          = 14u,  ///< Malformed line of config file
+        UNRECOGNIZED_CONFIG_KEY     = 15u,  ///< Key of config file isn't registered
+        MISSING_REQUIRED_OPTION     = 16u,  ///< Required argument is missing
+        EXCLUSIVE_OPTIONS           = 17u,  ///< Arguments of exclusive group conflict
+        MISSING_GROUP_OPTION        = 18u,  ///< Group requires one of its arguments
+        MISSING_DEPENDENCY          = 19u,  ///< Argument requires another one
+        INVALID_OPTION              = 20u,  ///< UnixStyle indicator without option
+        INVALID_VALUE               = 21u,  ///< Value can't be converted
+        VALUE_OUT_OF_RANGE          = 22u   ///< Value is out of range
+    };
+
+    /**
+     * @brief Returns description of error code
+     * @param[in] Code Error code
+     * @return Static null-terminated string
+     *
+     * @version 1.0.0
+     * @authors Eugene Azimut
+     */
+    ARGPARSE_API const char *getErrorMessage(ErrorCode Code) noexcept;
+
+    /**
+     * @struct ArgparseError
+     * @brief Error reported by non-throwing parsing API
+     * @details Building and returning an error allocates nothing:
+     * the offending argument is a view into argv (or into a response file mapped
+     * by the parse result) and the description is a static string
+     *
+     * @version 1.0.0
+     * @authors Eugene Azimut
+     */
+    struct ArgparseError {
+        ErrorCode  Code     = SUCCESS;  ///< Error code
+        int        Position = 0;        ///< Index of the offending argument in argv, line of config file (0 for environment), index of group or rule
+        StringView Arg;                 ///< Offending argument
+
+        /**
+         * @brief Checks if error occurred
+         * @return true in case of error, false in case of success
+         *
+         * @version 1.0.0
+         * @authors Eugene Azimut
+         */
+        explicit operator bool() const noexcept {
+            return Code != SUCCESS;
+        }
+
+        /**
+         * @brief Returns description of the error
+         * @return Static null-terminated string, see getErrorMessage(ErrorCode)
+         *
+         * @version 1.0.0
+         * @authors Eugene Azimut
+         */
+        const char *what() const noexcept {
+            return getErrorMessage(Code);
+        }
+    };
+}
@@ -8,12 +8,45 @@
  */
 #pragma once
 #include "api.hpp"
+#include "ArgparseError.hpp"
+#include "StringView.hpp"
+#include "CompiledParser.hpp"
+#include "FlagIndex.hpp"
+#include "FlagTrie.hpp"
+#include "HelpFormatter.hpp"
+#include "ParseResult.hpp"
+#include "OptionStyles/OptionStyle.hpp"
+#include "OptionStyles/UnixStyle.hpp"
+#include "args/IOptionalArgument.hpp"
 
+#include <array>
+#include <cstdint>
+#include <functional>
+#include <memory>
 #include <string>
+#include <type_traits>
+#include <utility>
+#include <vector>
 
 
 
 namespace argparse {
+    /**
+     * @brief Kinds of argument groups
+     * @details Values:\n
+     * * "MUTUALLY_EXCLUSIVE" - at most one argument of the group may be given\n
+     * * "AT_LEAST_ONE"       - at least one argument of the group must be given\n
+     * * "EXACTLY_ONE"        - exactly one argument of the group must be given
+     *
+     * @version 1.0.0
+     * @authors Eugene Azimut
+     */
+    ARGPARSE_API enum GroupKind: uint8_t {
+        MUTUALLY_EXCLUSIVE  = 0u,   ///< At most one argument
+        AT_LEAST_ONE        = 1u,   ///< One or more arguments
+        EXACTLY_ONE         = 2u    ///< One argument
+    };
+
     /**
      * @class ArgumentParser
      * @brief Contains methods for parsing CLI arguments
@@ -23,6 +56,25 @@ namespace argparse {
      */
     ARGPARSE_API class ArgumentParser {
     public:
+        /**
+         * @brief Maximum nesting of response files
+         * @details A response file may reference other response files:
+         * "@a" containing "@b" is nesting of depth 2
+         *
+         * @version 1.0.0
+         * @authors Eugene Azimut
+         */
+        static constexpr size_t RESPONSE_FILES_DEPTH = 16;
+
+        /**
+         * @brief Function registering arguments of a subcommand
+         * @details Receives an empty parser with the option style and settings of the parent
+         *
+         * @version 1.0.0
+         * @authors Eugene Azimut
+         */
+        using SubcommandFactory = std::function<void (ArgumentParser &)>;
+
     //* Ctors and dtor
         /**
          * @brief Default constructor
@@ -63,17 +115,862 @@ namespace argparse {
          */
         virtual ~ArgumentParser() noexcept;
 
+    //* Getters and setters
+        /**
+         * @brief Get option style used for parsing
+         * @return Option style. Default: OptStyles::UnixStyle
+         *
+         * @version 1.0.0
+         * @authors Eugene Azimut
+         */
+        virtual const OptStyles::OptionStyle &getOptionStyle() const;
+
+        /**
+         * @brief Set option style used for parsing
+         * @details The parser keeps its own copy of Style.
+         * Arguments registered before keep their kind: positional or optional
+         *
+         * @tparam StyleType OptStyles::OptionStyle or its inheritor
+         * @param[in] Style New option style
+         *
+         * @throw std::bad_alloc in case of memory allocation failure
+         *
+         * @version 1.0.0
+         * @authors Eugene Azimut
+         */
+        template<typename StyleType>
+        void setOptionStyle(const StyleType &Style) {
+            static_assert(
+                std::is_base_of<OptStyles::OptionStyle, StyleType>::value,
+                "Style must be an inheritor of argparse::OptStyles::OptionStyle"
+            );
+            mStyle = std::make_shared<StyleType>(Style);
+            invalidateHelp();
+        }
+
+        /**
+         * @brief Get result of the last ArgumentParser::parse(int, const char *[]) call
+         * @return Parsing result
+         *
+         * @version 1.0.0
+         * @authors Eugene Azimut
+         */
+        virtual const ParseResult &getResult() const;
+
+        /**
+         * @brief Get program name shown in usage
+         * @return Program name. Default: base name of argv[0] of the first
+         * ArgumentParser::parse(int, const char *[]) call
+         *
+         * @version 1.0.0
+         * @authors Eugene Azimut
+         */
+        virtual const std::string &getProgramName() const;
+
+        /**
+         * @brief Set program name shown in usage
+         * @param[in] Name Program name
+         *
+         * @throw std::bad_alloc in case of memory allocation failure
+         *
+         * @version 1.0.0
+         * @authors Eugene Azimut
+         */
+        virtual void setProgramName(const std::string &Name);
+
+        /**
+         * @brief Get description shown in help after usage
+         * @return Description. Default: ""
+         *
+         * @version 1.0.0
+         * @authors Eugene Azimut
+         */
+        virtual const std::string &getDescription() const;
+
+        /**
+         * @brief Set description shown in help after usage
+         * @param[in] Description What the program does
+         *
+         * @throw std::bad_alloc in case of memory allocation failure
+         *
+         * @version 1.0.0
+         * @authors Eugene Azimut
+         */
+        virtual void setDescription(const std::string &Description);
+
+        /**
+         * @brief Set size of the first block of the parser arena
+         * @details All per-parse data of ArgumentParser::parse(int, const char *[])
+         * is allocated from one arena, which is reset and reused by the next call.
+         * A block size fitting the whole command line avoids growing on the first call
+         *
+         * @param[in] BlockSize Size in bytes
+         *
+         * @version 1.0.0
+         * @authors Eugene Azimut
+         */
+        virtual void setArenaBlockSize(size_t BlockSize);
+
+        /**
+         * @brief Get whether or not "@path" arguments are expanded
+         * @return Whether or not response files are enabled. Default: false
+         *
+         * @version 1.0.0
+         * @authors Eugene Azimut
+         */
+        virtual bool isResponseFilesEnabled() const;
+
+        /**
+         * @brief Set whether or not "@path" arguments are expanded
+         * @details When enabled, every "@path" argument is replaced by arguments
+         * read from the file at path. The file is mapped into memory and split in place:
+         *   * Arguments are separated by whitespace;
+         *   * Text in single quotes is taken literally;
+         *   * Text in double quotes may contain escaped \" and \\;
+         *   * Outside quotes a backslash escapes any character;
+         *   * Response files may reference other response files,
+         *     see ArgumentParser::RESPONSE_FILES_DEPTH
+         *   * "@path" after "--" is a positional value, not a response file
+         *
+         * @param[in] IsEnabled Whether or not response files are enabled
+         *
+         * @version 1.0.0
+         * @authors Eugene Azimut
+         */
+        virtual void setResponseFilesEnabled(bool IsEnabled = true);
+
+        /**
+         * @brief Get whether or not long options may be abbreviated
+         * @return Whether or not abbreviations are enabled. Default: false
+         *
+         * @version 1.0.0
+         * @authors Eugene Azimut
+         */
+        virtual bool isAbbreviationsEnabled() const;
+
+        /**
+         * @brief Set whether or not long options may be abbreviated
+         * @details When enabled, an unknown option which is a prefix of flags
+         * of exactly one argument resolves to that argument, e.g. "--verb" to "--verbose".
+         * Exact flags always win. Prefixes of flags of several arguments are rejected
+         * with ErrorCode::AMBIGUOUS_OPTION, see ArgumentParser::getCandidates(const StringView &) const.\n
+         * Resolution walks a prefix tree of all registered flags and costs O(length of option)
+         * regardless of number of arguments. Short options aren't abbreviated
+         *
+         * @param[in] IsEnabled Whether or not abbreviations are enabled
+         *
+         * @version 1.0.0
+         * @authors Eugene Azimut
+         */
+        virtual void setAbbreviationsEnabled(bool IsEnabled = true);
+
+        /**
+         * @brief Get path to config file read by every parse
+         * @return Path to config file. Default: "" (no config file)
+         *
+         * @version 1.0.0
+         * @authors Eugene Azimut
+         */
+        virtual const std::string &getConfigFile() const;
+
+        /**
+         * @brief Set path to config file read by every parse
+         * @details The file is mapped into memory and scanned once, values are views into the mapping
+         * kept by the parse result. Every line is one of:
+         *   * "key = value" - occurrence of the argument with flag "<indicator>key" and the value,
+         *     e.g. "threads = 8" for "--threads" in OptStyles::UnixStyle.
+         *     Value may be enclosed in double or single quotes;
+         *   * "key" - occurrence of the argument without value;
+         *   * "[section]" - following keys are prefixed with "section.", e.g. "--log.level".
+         *     "[]" returns to keys without prefix;
+         *   * Empty line or comment starting with '#' or ';'
+         *
+         * Spaces and tabs around keys and values are ignored, a repeated key is a repeated occurrence.\n
+         * Keys apply only to arguments which occur neither on the command line
+         * nor in the environment (see args::IArgument::setEnvVar(const std::string &)),
+         * so the command line overrides the environment, which overrides the config file.
+         * Errors are reported with the line number as ArgparseError::Position.\n
+         * A missing file is skipped, a file which exists but can't be read
+         * is reported as ErrorCode::CONFIG_FILE_UNREADABLE.
+         * The file is read again by every parse, so edits apply to the next parse,
+         * results own the mapping their values view, and CompiledParser keeps no mutable state
+         *
+         * @param[in] Path Path to config file. Empty disables config file
+         *
+         * @throw std::bad_alloc in case of memory allocation failure
+         *
+         * @version 1.0.0
+         * @authors Eugene Azimut
+         */
+        virtual void setConfigFile(const std::string &Path);
+
     //* etc
+        /**
+         * @brief Registers optional or positional argument
+         * @details The parser keeps its own copy (or moved instance) of Argument.
+         * Output variables bound to Argument are shared with the copy.\n
+         * All flags of Argument are added to the parser flag index,
+         * so changing them after registration has no effect on parsing.\n
+         * Argument with a single flag which isn't an option of the parser style,
+         * e.g. "files" in OptStyles::UnixStyle, is positional: it takes values
+         * which don't belong to options, in order of registration.
+         * Positional arguments consuming at least one value are required.
+         * Values are distributed after the whole command line is read:
+         * every positional argument greedily takes as many values as it can
+         * while leaving the minimum for the next ones, so N values cost O(N)
+         * without any backtracking.\n
+         * Example:
+         * @code {.cpp}
+         *     Parser.addArgument(ListArg(Sources, {"sources"}, "Files to copy", NARGS::ONE_AND_MORE));
+         *     Parser.addArgument(ListArg(Destination, {"destination"}, "Target directory"));
+         * @endcode
+         * Command line "./my_prog a b c dir" gives Sources = {"a", "b", "c"} and Destination = {"dir"}
+         *
+         * @tparam Arg args::IOptionalArgument inheritor
+         * @param[in] Argument Argument to be registered
+         * @return Reference to the registered copy
+         *
+         * @throw std::invalid_argument in case one of flags is already registered
+         * or a positional argument has several flags or doesn't consume values
+         * @throw std::bad_alloc in case of memory allocation failure
+         * @throw Exceptions from copy (move) constructor of Arg
+         *
+         * @version 1.0.0
+         * @authors Eugene Azimut
+         */
+        template<typename Arg>
+        typename std::decay<Arg>::type &addArgument(Arg &&Argument) {
+            using ArgType = typename std::decay<Arg>::type;
+            static_assert(
+                std::is_base_of<args::IOptionalArgument, ArgType>::value,
+                "Arg must be an inheritor of argparse::args::IOptionalArgument"
+            );
+
+            std::shared_ptr<ArgType> Registered = std::make_shared<ArgType>(std::forward<Arg>(Argument));
+            registerArgument(Registered, &copyArgument<ArgType>);
+            return *Registered;
+        }
+
+        /**
+         * @brief Registers group of arguments
+         * @details Groups are checked after the whole command line, the environment and
+         * the config file are read, together with required arguments
+         * (see args::IArgument::isRequired() const). Every argument has a bit in the set
+         * of seen arguments and every group is a mask over it, so a check costs
+         * a few word operations per 64 arguments and never visits the arguments themselves.\n
+         * Violations are reported as ErrorCode::EXCLUSIVE_OPTIONS or ErrorCode::MISSING_GROUP_OPTION
+         * with the group index (order of registration) as ArgparseError::Position
+         *
+         * @param[in] Kind Kind of group
+         * @param[in] Members Any flag of every member, e.g. {"--json", "--yaml"}
+         *
+         * @throw std::invalid_argument in case of unregistered flag or less than 2 members
+         * @throw std::bad_alloc in case of memory allocation failure
+         *
+         * @version 1.0.0
+         * @authors Eugene Azimut
+         */
+        void addGroup(GroupKind Kind, const std::vector<std::string> &Members);
+
+        /**
+         * @brief Returns every violated constraint of Result
+         * @details Constraints are required arguments, groups (see ArgumentParser::addGroup)
+         * and rules of arguments (see args::IArgument::addRequires(const std::string &)).
+         * Rules are compiled once into bit masks: every argument with rules has the mask of arguments
+         * it requires, which is checked against seen arguments word by word, so the check costs
+         * O(arguments / 64) per seen argument with rules. Violated rules are reported as
+         * ErrorCode::MISSING_DEPENDENCY with the flag of the argument with the rule as ArgparseError::Arg
+         * and the registration index of the required argument as ArgparseError::Position.\n
+         * Parsing stops at the first violation, use this method to report all of them
+         *
+         * @param[in] Result Result of this parser
+         * @return Violations: required arguments first, then groups, then rules
+         *
+         * @throw std::bad_alloc in case of memory allocation failure
+         * @throw std::invalid_argument in case a rule references unregistered flag
+         * or Result is a result of another parser
+         *
+         * @version 1.0.0
+         * @authors Eugene Azimut
+         */
+        std::vector<ArgparseError> getViolations(const ParseResult &Result) const;
+
+        /**
+         * @brief Registers git-style subcommand
+         * @details Factory isn't invoked until the subcommand is selected: only the parser
+         * of the subcommand named on the command line is built (once, then reused),
+         * so binaries with many subcommands don't pay for arguments of the others.\n
+         * The first argument matching a subcommand name selects it, arguments after it
+         * are parsed by the subcommand parser, see ParseResult::getSubcommandResult() const
+         *
+         * @param[in] Name Subcommand name, e.g. "commit"
+         * @param[in] Factory Function registering arguments of the subcommand
+         * @param[in] Help A brief description of what the subcommand does
+         *
+         * @throw std::invalid_argument in case of empty or already registered Name or empty Factory
+         * @throw std::bad_alloc in case of memory allocation failure
+         *
+         * @version 1.0.0
+         * @authors Eugene Azimut
+         */
+        void addSubcommand(const std::string &Name, const SubcommandFactory &Factory, const std::string &Help = "");
+
+        /**
+         * @brief Returns parser of subcommand, building it if needed
+         * @param[in] Name Subcommand name
+         * @return Subcommand parser
+         *
+         * @throw std::out_of_range in case Name isn't registered
+         * @throw Exceptions from the subcommand factory
+         *
+         * @version 1.0.0
+         * @authors Eugene Azimut
+         */
+        ArgumentParser &getSubcommand(const std::string &Name);
+
+        /**
+         * @brief Parses CLI arguments
+         * @details Makes a single pass over argv[1..argc) using the configured option style:
+         *   * Every registered argument receives args::IArgument::applyDefault() first,
+         *     then args::IArgument::reserveValues(uint32_t) if it consumed any values;
+         *   * Every recognized option receives args::IArgument::applyFlag()
+         *     and then args::IArgument::applyValue(const StringView &) for each consumed value.
+         *     Values are taken from the option itself ("--flag=value") and from following
+         *     arguments according to the argument NArgs;
+         *   * Short options may be clustered ("-xvzf file" is "-x -v -z -f file"): characters
+         *     are taken as options until one accepting values, the rest of the cluster is its value;
+         *   * Long options may be abbreviated if enabled (see ArgumentParser::setAbbreviationsEnabled(bool));
+         *   * Arguments which are neither options nor their values are collected
+         *     and distributed among positional arguments when argv is read, see ArgumentParser::addArgument(Arg &&);
+         *   * "--" (in styles supporting it) ends options, the rest are positional arguments;
+         *   * "@path" is replaced by arguments read from the file at path
+         *     if response files are enabled (see ArgumentParser::setResponseFilesEnabled(bool));
+         *   * Name of a registered subcommand passes the rest of argv to the subcommand parser
+         *     (see ArgumentParser::addSubcommand), whose callbacks are invoked after the parser ones;
+         *   * Implied arguments (see args::IArgument::addImplies(const std::string &)) are added,
+         *     then required arguments, groups (see ArgumentParser::addGroup) and rules
+         *     (see args::IArgument::addRequires(const std::string &)) are checked last.
+         *     All violated constraints are reported at once
+         *
+         * No argument is copied: values are passed as views into argv or into response files
+         * mapped by the result.
+         * Occurrences and values are first collected into the parser result
+         * (see ArgumentParser::getResult() const), callbacks are invoked when the whole
+         * command line is accepted
+         *
+         * @param[in] argc Number of CLI arguments
+         * @param[in] argv CLI arguments. argv[0] is the program name and is skipped
+         *
+         * @throw std::runtime_error in case of malformed, unrecognized or missing arguments,
+         * violated constraints or unreadable, malformed or too deeply nested response files
+         * @throw std::invalid_argument in case a rule references unregistered flag
+         * @throw Exceptions from callbacks of registered arguments
+         *
+         * @version 1.0.0
+         * @authors Eugene Azimut
+         */
         virtual void parse(int argc, const char *argv[]);
 
-    protected:
-        virtual void splitOption(
-            const std::string &Arg,
-            std::string &Option,
-            std::string &Value
-        ) const;
+        /**
+         * @brief Parses CLI arguments into Result
+         * @details Makes the same pass as ArgumentParser::parse(int, const char *[]),
+         * but only records occurrences and values in Result: callbacks
+         * of registered arguments aren't invoked and output variables aren't touched.\n
+         * Result is cleared first, its arena is reused
+         *
+         * @param[in] argc Number of CLI arguments
+         * @param[in] argv CLI arguments. argv[0] is the program name and is skipped
+         * @param[out] Result Parsing result. Arguments are identified by registration index,
+         * see ArgumentParser::indexOf(const StringView &) const
+         *
+         * @throw std::runtime_error in case of malformed, unrecognized or missing arguments,
+         * invalid values or unreadable, malformed or too deeply nested response files
+         * @throw std::invalid_argument in case a rule references unregistered flag
+         * @throw std::bad_alloc in case of memory allocation failure
+         *
+         * @note Not thread-safe although const: constraints and subcommand parsers are built
+         * lazily on the first parse. Parse concurrently through ArgumentParser::compile() const
+         *
+         * @version 1.0.0
+         * @authors Eugene Azimut
+         */
+        void parse(int argc, const char *argv[], ParseResult &Result) const;
+
+        /**
+         * @brief Parses CLI arguments without throwing on malformed input
+         * @details Non-throwing version of ArgumentParser::parse(int, const char *[]).
+         * Callbacks of registered arguments are invoked only if the whole command line is accepted
+         *
+         * @param[in] argc Number of CLI arguments
+         * @param[in] argv CLI arguments. argv[0] is the program name and is skipped
+         * @return Error of the first rejected argument. Converts to false in case of success
+         *
+         * @throw std::bad_alloc in case of memory allocation failure
+         * @throw Exceptions from callbacks of registered arguments
+         *
+         * @version 1.0.0
+         * @authors Eugene Azimut
+         */
+        ArgparseError tryParse(int argc, const char *argv[]);
+
+        /**
+         * @brief Parses CLI arguments into Result without throwing on malformed input
+         * @details Non-throwing version of ArgumentParser::parse(int, const char *[], ParseResult &) const.
+         * Reporting an error allocates nothing: rejecting invalid command lines
+         * costs as much as accepting valid ones.\n
+         * Arguments read from a response file are reported at the position of its "@path".\n
+         * Values are checked by args::IArgument::validateValue(const StringView &) const when they
+         * are bound: rejected ones are reported as INVALID_VALUE or VALUE_OUT_OF_RANGE.\n
+         * Arguments omitted on the command line take values of their environment variables,
+         * see args::IArgument::setEnvVar(const std::string &), then values of the config file,
+         * see ArgumentParser::setConfigFile(const std::string &)
+         *
+         * @param[in] argc Number of CLI arguments
+         * @param[in] argv CLI arguments. argv[0] is the program name and is skipped
+         * @param[out] Result Parsing result. Incomplete in case of error
+         * @return Error of the first rejected argument. Converts to false in case of success
+         *
+         * @throw std::bad_alloc in case of memory allocation failure
+         * @throw std::invalid_argument in case a rule references unregistered flag
+         * @throw Exceptions from factories of subcommands
+         *
+         * @note Not thread-safe, see ArgumentParser::parse(int, const char *[], ParseResult &) const
+         *
+         * @version 1.0.0
+         * @authors Eugene Azimut
+         */
+        ArgparseError tryParse(int argc, const char *argv[], ParseResult &Result) const;
+
+        /**
+         * @brief Returns registration index of argument with Flag
+         * @param[in] Flag Option with indicator, e.g. "--flag"
+         * @return Index or FlagIndex::NOT_FOUND
+         *
+         * @version 1.0.0
+         * @authors Eugene Azimut
+         */
+        uint32_t indexOf(const StringView &Flag) const;
+
+        /**
+         * @brief Returns registered flags closest to unknown Flag
+         * @details Intended for reporting ErrorCode::UNRECOGNIZED_OPTION: nothing is computed
+         * until it is called. Distance is the optimal string alignment distance
+         * (insertions, deletions, substitutions and transpositions of adjacent characters)
+         * computed by bit-parallel algorithm with early cutoff, so flags which are far away
+         * are rejected after a few characters. Flags longer than 64 characters don't fit
+         * the bit vectors and are compared row by row instead
+         *
+         * @param[in] Flag Unknown flag, e.g. "--verbsoe"
+         * @param[in] MaxDistance Maximum distance of suggested flags
+         * @return Flags with the smallest distance not exceeding MaxDistance, in order of registration
+         *
+         * @throw std::bad_alloc in case of memory allocation failure
+         *
+         * @version 1.0.0
+         * @authors Eugene Azimut
+         */
+        std::vector<std::string> getSuggestions(const StringView &Flag, size_t MaxDistance = 2) const;
+
+        /**
+         * @brief Returns registered flags starting with Prefix
+         * @details Intended for reporting ErrorCode::AMBIGUOUS_OPTION: scans all flags
+         *
+         * @param[in] Prefix Beginning of flags, e.g. "--verb"
+         * @return Flags in order of registration
+         *
+         * @throw std::bad_alloc in case of memory allocation failure
+         *
+         * @version 1.0.0
+         * @authors Eugene Azimut
+         */
+        std::vector<std::string> getCandidates(const StringView &Prefix) const;
+
+        /**
+         * @brief Freezes current configuration
+         * @details Takes a snapshot of the option style, registered arguments
+         * and their parameters. The snapshot can be shared between threads
+         * parsing concurrently, see CompiledParser.\n
+         * Parsers of all subcommands are built and compiled too
+         *
+         * @return Compiled parser
+         *
+         * @throw std::bad_alloc in case of memory allocation failure
+         *
+         * @version 1.0.0
+         * @authors Eugene Azimut
+         */
+        CompiledParser compile() const;
+
+        /**
+         * @brief Returns help text
+         * @details Help consists of:
+         *   * Usage line: program name, every option ("[-v]", "--name NAME" if required)
+         *     and subcommands ("{add,remove} ...");
+         *   * Description, see ArgumentParser::setDescription(const std::string &);
+         *   * "options:" section: flags of every argument with name of values
+         *     (see args::IOptionalArgument::getMetavar() const) and its NArgs
+         *     ("-j, --jobs JOBS", "--files [FILES ...]"), help, deprecation mark and environment variable;
+         *   * "subcommands:" section: name and help of every subcommand
+         *
+         * Text is wrapped to Width, help of entries is aligned in one column.
+         * The text is rendered once and cached until arguments (including changes made through
+         * references returned by ArgumentParser::addArgument(Arg &&)), subcommands, the option style,
+         * the program name, the description or Width change
+         *
+         * @param[in] Width Maximum line width. Values less than HelpFormatter::MIN_WIDTH are raised to it
+         * @return Help text valid until the next change of the parser
+         *
+         * @throw std::bad_alloc in case of memory allocation failure
+         *
+         * @version 1.0.0
+         * @authors Eugene Azimut
+         */
+        const std::string &formatHelp(size_t Width = HelpFormatter::DEFAULT_WIDTH) const;
+
+        /**
+         * @brief Writes help to file descriptor
+         * @details Help is formatted for the width of terminal attached to Fd
+         * (see HelpFormatter::getTerminalWidth(int)) and written by a single write(2)
+         *
+         * @param[in] Fd File descriptor. Default: standard output
+         * @return false in case of write error
+         *
+         * @throw std::bad_alloc in case of memory allocation failure
+         *
+         * @version 1.0.0
+         * @authors Eugene Azimut
+         */
+        bool printHelp(int Fd = 1) const;
+
+        /**
+         * @brief Writes usage line to file descriptor
+         * @details Usage is the first part of cached help, see ArgumentParser::printHelp(int) const
+         *
+         * @param[in] Fd File descriptor. Default: standard error
+         * @return false in case of write error
+         *
+         * @throw std::bad_alloc in case of memory allocation failure
+         *
+         * @version 1.0.0
+         * @authors Eugene Azimut
+         */
+        bool printUsage(int Fd = 2) const;
 
     private:
+        friend class CompiledParser;
+
+        /**
+         * @brief Function copying registered argument with its actual type
+         * @details Lets CompiledParser keep private copies which still validate values
+         *
+         * @version 1.0.0
+         * @authors Eugene Azimut
+         */
+        using ArgumentCopier = std::shared_ptr<args::IOptionalArgument> (*)(const args::IOptionalArgument &);
+
+        /**
+         * @struct Group
+         * @brief Registered group of arguments
+         *
+         * @version 1.0.0
+         * @authors Eugene Azimut
+         */
+        struct Group {
+            GroupKind             Kind;         ///< Kind of group
+            std::vector<uint32_t> Members;      ///< Registration indices of members
+            std::vector<uint64_t> Mask;         ///< Bits of members
+        };
+
+        /**
+         * @struct PositionalValue
+         * @brief Value collected for positional arguments
+         *
+         * @version 1.0.0
+         * @authors Eugene Azimut
+         */
+        struct PositionalValue {
+            StringView Value;       ///< View into argv or into response file
+            int        Position;    ///< Position of value in argv
+        };
+
+        /**
+         * @struct Subcommand
+         * @brief Registered subcommand
+         *
+         * @version 1.0.0
+         * @authors Eugene Azimut
+         */
+        struct Subcommand {
+            std::string       Name;                     ///< Subcommand name
+            std::string       Help;                     ///< A brief description of the subcommand
+            SubcommandFactory Factory;                  ///< Function registering arguments
+            std::shared_ptr<ArgumentParser> Parser;     ///< Built parser or nullptr
+        };
+
+        /**
+         * @brief Parses argv[First..argc) into Result
+         * @details Positions of errors are indices in the whole argv
+         *
+         * @param[in] First Index of the first parsed argument
+         * @param[in] argc Number of CLI arguments
+         * @param[in] argv CLI arguments
+         * @param[out] Result Parsing result. Incomplete in case of error
+         * @return Error of the first rejected argument. Converts to false in case of success
+         *
+         * @throw std::bad_alloc in case of memory allocation failure
+         * @throw std::invalid_argument in case a rule references unregistered flag
+         * @throw Exceptions from factories of subcommands
+         *
+         * @version 1.0.0
+         * @authors Eugene Azimut
+         */
+        ArgparseError parseFrom(int First, int argc, const char *argv[], ParseResult &Result) const;
+
+        /**
+         * @brief Returns parser of subcommand, invoking its factory on the first call
+         * @details The parser is built lazily: the cache isn't a part of the parser configuration
+         *
+         * @param[in] Index Registration index of subcommand
+         * @return Subcommand parser
+         *
+         * @throw std::bad_alloc in case of memory allocation failure
+         * @throw Exceptions from the subcommand factory
+         *
+         * @version 1.0.0
+         * @authors Eugene Azimut
+         */
+        ArgumentParser &buildSubcommand(uint32_t Index) const;
+
+        /**
+         * @brief Returns parser which rejected Result: the innermost selected subcommand
+         * @param[in,out] Result Parsing result. Replaced by the result of the innermost subcommand
+         * @return This parser or one of subcommand parsers
+         *
+         * @version 1.0.0
+         * @authors Eugene Azimut
+         */
+        const ArgumentParser &selectedParser(const ParseResult *&Result) const;
+
+        /**
+         * @brief Compiles required arguments and rules if arguments changed since the last compilation
+         * @details Compiled by the first parse after registration and again after any argument changes
+         * (see args::IArgument::getRevision() const), so requirements and rules
+         * changed through references returned by ArgumentParser::addArgument(Arg &&) count:
+         *   * Required arguments become one mask;
+         *   * Every argument with "requires" rules gets a mask of arguments it requires;
+         *   * Implications are closed transitively: every implying argument gets a mask
+         *     of all arguments it implies
+         *
+         * @throw std::bad_alloc in case of memory allocation failure
+         * @throw std::invalid_argument in case a rule references unregistered flag
+         *
+         * @version 1.0.0
+         * @authors Eugene Azimut
+         */
+        void compileConstraints() const;
+
+        /**
+         * @brief Records occurrences of arguments implied by arguments seen in Result
+         * @param[in,out] Result Parsing result of the command line, the environment and the config file
+         *
+         * @throw std::bad_alloc in case of memory allocation failure
+         *
+         * @version 1.0.0
+         * @authors Eugene Azimut
+         */
+        void applyImplications(ParseResult &Result) const;
+
+        /**
+         * @brief Checks required arguments, groups and rules against arguments seen in Result
+         * @param[in] Result Parsing result with applied implications
+         * @param[out] Violations Receives every violation if not nullptr
+         * @return The first violation. Converts to false in case of success
+         *
+         * @throw std::bad_alloc in case of memory allocation failure
+         *
+         * @version 1.0.0
+         * @authors Eugene Azimut
+         */
+        ArgparseError checkConstraints(const ParseResult &Result, std::vector<ArgparseError> *Violations) const;
+
+        /**
+         * @brief Describes violation: its message, offending flag and related flags
+         * @param[in] Violation Violation reported by this parser
+         * @return Description, e.g. "option requires another one - --tls-cert (requires --tls-key)"
+         *
+         * @throw std::bad_alloc in case of memory allocation failure
+         *
+         * @version 1.0.0
+         * @authors Eugene Azimut
+         */
+        std::string describeViolation(const ArgparseError &Violation) const;
+
+        /**
+         * @brief Returns the first flag of argument
+         * @param[in] Index Registration index of argument
+         * @return View of the flag or an empty view
+         *
+         * @version 1.0.0
+         * @authors Eugene Azimut
+         */
+        StringView flagOf(uint32_t Index) const;
+
+        /**
+         * @brief Returns revision of registered arguments
+         * @details Sum of args::IArgument::getRevision() const of every argument.
+         * Revisions only grow, so the sum changes whenever any argument is changed
+         *
+         * @return Revision of arguments
+         *
+         * @version 1.0.0
+         * @authors Eugene Azimut
+         */
+        uint64_t getArgumentsRevision() const;
+
+        /**
+         * @brief Drops cached help
+         *
+         * @version 1.0.0
+         * @authors Eugene Azimut
+         */
+        void invalidateHelp();
+
+        /**
+         * @brief Copies argument registered as ArgType
+         *
+         * @tparam ArgType Type the argument was registered with
+         * @param[in] Argument Argument to be copied
+         * @return Copy of the argument
+         *
+         * @throw std::bad_alloc in case of memory allocation failure
+         * @throw Exceptions from copy constructor of ArgType
+         *
+         * @version 1.0.0
+         * @authors Eugene Azimut
+         */
+        template<typename ArgType>
+        static std::shared_ptr<args::IOptionalArgument> copyArgument(const args::IOptionalArgument &Argument) {
+            return std::make_shared<ArgType>(static_cast<const ArgType &>(Argument));
+        }
+
+        /**
+         * @brief Adds argument to the list of registered arguments and its flags to the index
+         * @param[in] Argument Argument to be registered
+         * @param[in] Copier   Function copying the argument with its actual type
+         *
+         * @throw std::invalid_argument in case one of flags is already registered
+         * or a positional argument has several flags or doesn't consume values
+         * @throw std::bad_alloc in case of memory allocation failure
+         *
+         * @version 1.0.0
+         * @authors Eugene Azimut
+         */
+        void registerArgument(const std::shared_ptr<args::IOptionalArgument> &Argument, ArgumentCopier Copier);
+
+        /**
+         * @brief Returns true if Flag isn't an option of the parser style
+         * @param[in] Flag Flag of argument
+         * @return Boolean value
+         *
+         * @version 1.0.0
+         * @authors Eugene Azimut
+         */
+        bool isPositionalFlag(const std::string &Flag) const;
+
+        /**
+         * @brief Records Value of argument Index if the argument accepts it
+         * @details Values are checked by args::IArgument::validateValue(const StringView &) const
+         * as soon as they are bound, so non-throwing parsing reports bad values
+         * and callbacks never get them
+         *
+         * @param[in] Index Index of argument
+         * @param[in] Value Bound value
+         * @param[in,out] Result Parsing result
+         * @return ErrorCode::SUCCESS or error code of the check
+         *
+         * @throw std::bad_alloc in case of memory allocation failure
+         *
+         * @version 1.0.0
+         * @authors Eugene Azimut
+         */
+        ErrorCode bindValue(uint32_t Index, const StringView &Value, ParseResult &Result) const;
+
+        /**
+         * @brief Distributes values collected from the command line among positional arguments
+         * @details One pass over positional arguments: every argument takes
+         * min(maximum, values left - minimum of the next arguments) values.
+         * If values are too few for all minimums, arguments are filled up to their minimum
+         * in order and the rest stay missing
+         *
+         * @param[in] Values Collected values in command-line order
+         * @param[in] Count Number of values
+         * @param[in,out] Result Parsing result
+         * @return ErrorCode::UNRECOGNIZED_ARGUMENT for the first extra value,
+         * ErrorCode::EXPECTED_MORE_VALUES for partially filled argument,
+         * error of ArgumentParser::bindValue for rejected value. Converts to false in case of success
+         *
+         * @version 1.0.0
+         * @authors Eugene Azimut
+         */
+        ArgparseError distributePositionals(const PositionalValue *Values, size_t Count, ParseResult &Result) const;
+
+        /**
+         * @brief Invokes callbacks of registered arguments in command-line order
+         * @param[in] Result Parsing result
+         *
+         * @throw Exceptions from callbacks of registered arguments
+         *
+         * @version 1.0.0
+         * @authors Eugene Azimut
+         */
+        void apply(const ParseResult &Result) const;
+
+        /**
+         * @brief Returns registration index of argument with short flag "-Option"
+         * @details Direct lookup in 256-entry table: no hashing, no comparisons
+         *
+         * @param[in] Option Character of short option
+         * @return Index or FlagIndex::NOT_FOUND
+         *
+         * @version 1.0.0
+         * @authors Eugene Azimut
+         */
+        uint32_t shortIndexOf(char Option) const;
+
+        /**
+         * @brief Records environment variables of arguments omitted on the command line
+         * @details Names of wanted variables are put into a hash table allocated from
+         * the arena of Result, then environment is scanned once.
+         * A found variable is recorded as an occurrence of its argument with the variable value,
+         * so it goes through the same ArgumentParser::apply(const ParseResult &) const path
+         * as values of the command line. Recorded values point into the environment
+         *
+         * @param[in,out] Result Parsing result of the command line
+         * @return Error of ArgumentParser::bindValue for rejected value.
+         * Position is 0 and Arg is the whole "NAME=value" entry. Converts to false in case of success
+         *
+         * @throw std::bad_alloc in case of memory allocation failure
+         *
+         * @version 1.0.0
+         * @authors Eugene Azimut
+         */
+        ArgparseError readEnvironment(ParseResult &Result) const;
+
+        /**
+         * @brief Records values of config file for arguments omitted on the command line and in the environment
+         * @details See ArgumentParser::setConfigFile(const std::string &) for the format.
+         * Flags of keys are assembled in the arena of Result
+         *
+         * @param[in,out] Result Parsing result of the command line and the environment
+         * @return Error of the first rejected line. Converts to false in case of success
+         *
+         * @throw std::bad_alloc in case of memory allocation failure
+         *
+         * @version 1.0.0
+         * @authors Eugene Azimut
+         */
+        ArgparseError readConfig(ParseResult &Result) const;
+
         /**
          * @brief Copies current class members
          * @details The method copies members of only the given class,
@@ -103,5 +1000,32 @@ namespace argparse {
         void selfMove(ArgumentParser &&Other) noexcept;
 
     //* Variables
+        std::shared_ptr<OptStyles::OptionStyle> mStyle;                     ///< Option style
+        std::vector<std::shared_ptr<args::IOptionalArgument>> mOptionals;   ///< Registered optional arguments
+        std::vector<ArgumentCopier> mCopiers;                               ///< Copier of every argument of mOptionals
+        FlagIndex mFlagIndex;                                               ///< Flag to index in mOptionals
+        std::array<uint32_t, 256> mShortFlags;                              ///< Character of "-c" flag to index in mOptionals
+        FlagTrie mFlagTrie;                                                 ///< Prefix of flag to index in mOptionals
+        ParseResult mResult;                                                ///< Result of the last parse
+        std::string mConfigFile;                                            ///< Path to config file
+        mutable std::vector<Subcommand> mSubcommands;                       ///< Registered subcommands
+        FlagIndex mSubcommandIndex;                                         ///< Name of subcommand to index in mSubcommands
+        std::string mProgramName;                                           ///< Program name shown in usage
+        std::string mDescription;                                           ///< Description shown in help
+        std::vector<uint32_t> mPositionals;                                 ///< Indices of positional arguments in order of registration
+        std::vector<Group> mGroups;                                         ///< Registered groups
+        mutable std::vector<uint64_t> mRequiredMask;                        ///< Bits of required arguments
+        mutable std::vector<uint32_t> mRequiring;                           ///< Arguments with "requires" rules
+        mutable std::vector<uint64_t> mRequirements;                        ///< Arguments required by every argument of mRequiring
+        mutable std::vector<uint32_t> mImplying;                            ///< Arguments with implications
+        mutable std::vector<uint64_t> mImplied;                             ///< Closure of implications of every argument of mImplying
+        mutable bool mIsConstraintsCompiled;                                ///< Whether or not compiled constraints are up to date
+        mutable uint64_t mConstraintsRevision;                              ///< Revision of arguments in compiled constraints
+        mutable std::string mHelp;                                          ///< Cached help
+        mutable size_t mHelpWidth;                                          ///< Width of cached help or 0 if there is no cache
+        mutable uint64_t mHelpRevision;                                     ///< Revision of arguments in cached help
+        mutable size_t mUsageSize;                                          ///< Size of usage line in cached help
+        bool mIsResponseFilesEnabled;                                       ///< Whether or not "@path" is expanded
+        bool mIsAbbreviationsEnabled;                                       ///< Whether or not long options may be abbreviated
     };
 }
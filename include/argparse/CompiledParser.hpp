@@ -0,0 +1,231 @@
+/**
+ * @file CompiledParser.hpp
+ * @brief Declaration of immutable CLI arguments parser
+ *
+ * @version 1.0.0
+ * @authors Eugene Azimut
+ * @copyright Copyright (c) Eugene Azimut, 2026
+ */
+#pragma once
+#include "api.hpp"
+#include "ArgparseError.hpp"
+#include "StringView.hpp"
+#include "ParseResult.hpp"
+#include "OptionStyles/OptionStyle.hpp"
+
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <string>
+#include <vector>
+
+
+
+namespace argparse {
+    class ArgumentParser;
+
+    /**
+     * @class CompiledParser
+     * @brief Frozen configuration of ArgumentParser
+     * @details Created by ArgumentParser::compile() const. Keeps its own copies of
+     * the option style, the flag index and every registered argument (with its actual type,
+     * so values are validated as by the source parser), so later changes of the source parser or of its arguments don't affect it.\n
+     * Nothing in the compiled parser can be changed: any number of threads may call
+     * CompiledParser::parse(int, const char *[], ParseResult &) const concurrently
+     * without locks, each thread parsing into its own result.
+     * Copies share the same frozen configuration and are cheap
+     *
+     * @note Callbacks of arguments aren't invoked: output variables bound to them
+     * are shared between threads. Read occurrences and values from ParseResult instead
+     *
+     * @version 1.0.0
+     * @authors Eugene Azimut
+     */
+    ARGPARSE_API class CompiledParser {
+    public:
+    //* Ctors and dtor
+        /**
+         * @brief Compiles Parser
+         * @details Same as ArgumentParser::compile() const
+         *
+         * @param[in] Parser Configured parser
+         *
+         * @throw std::bad_alloc in case of memory allocation failure
+         * @throw Exceptions from factories of subcommands
+         *
+         * @version 1.0.0
+         * @authors Eugene Azimut
+         */
+        explicit CompiledParser(const ArgumentParser &Parser);
+
+        /**
+         * @brief Copy constructor
+         * @details The copy shares frozen configuration with Other
+         *
+         * @param[in] Other Instance to copy
+         *
+         * @version 1.0.0
+         * @authors Eugene Azimut
+         */
+        CompiledParser(const CompiledParser &Other);
+
+        /**
+         * @brief Destroies compiled parser
+         *
+         * @version 1.0.0
+         * @authors Eugene Azimut
+         */
+        virtual ~CompiledParser() noexcept;
+
+    //* Operators
+        /**
+         * @brief Copy assignment operator
+         * @details Shares frozen configuration with Other
+         *
+         * @param[in] Other Instance to copy
+         * @return Reference to this instance
+         *
+         * @version 1.0.0
+         * @authors Eugene Azimut
+         */
+        CompiledParser &operator=(const CompiledParser &Other);
+
+    //* Getters
+        /**
+         * @brief Get option style used for parsing
+         * @return Option style of the source parser at the time of compiling
+         *
+         * @version 1.0.0
+         * @authors Eugene Azimut
+         */
+        const OptStyles::OptionStyle &getOptionStyle() const;
+
+        /**
+         * @brief Get whether or not "@path" arguments are expanded
+         * @return Whether or not response files are enabled
+         *
+         * @version 1.0.0
+         * @authors Eugene Azimut
+         */
+        bool isResponseFilesEnabled() const;
+
+        /**
+         * @brief Get whether or not long options may be abbreviated
+         * @return Whether or not abbreviations are enabled
+         *
+         * @version 1.0.0
+         * @authors Eugene Azimut
+         */
+        bool isAbbreviationsEnabled() const;
+
+        /**
+         * @brief Get path to config file read by every parse
+         * @return Path to config file
+         *
+         * @version 1.0.0
+         * @authors Eugene Azimut
+         */
+        const std::string &getConfigFile() const;
+
+        /**
+         * @brief Returns number of registered arguments
+         * @return Number of arguments of the source parser at the time of compiling
+         *
+         * @version 1.0.0
+         * @authors Eugene Azimut
+         */
+        size_t size() const;
+
+    //* etc
+        /**
+         * @brief Parses CLI arguments into Result
+         * @details Same as ArgumentParser::parse(int, const char *[], ParseResult &) const.
+         * Safe to call concurrently with different results
+         *
+         * @param[in] argc Number of CLI arguments
+         * @param[in] argv CLI arguments. argv[0] is the program name and is skipped
+         * @param[out] Result Parsing result
+         *
+         * @throw std::runtime_error in case of malformed, unrecognized or missing arguments
+         * or unreadable, malformed or too deeply nested response files
+         * @throw std::bad_alloc in case of memory allocation failure
+         *
+         * @version 1.0.0
+         * @authors Eugene Azimut
+         */
+        void parse(int argc, const char *argv[], ParseResult &Result) const;
+
+        /**
+         * @brief Parses CLI arguments into Result without throwing on malformed input
+         * @details Same as ArgumentParser::tryParse(int, const char *[], ParseResult &) const.
+         * Safe to call concurrently with different results
+         *
+         * @param[in] argc Number of CLI arguments
+         * @param[in] argv CLI arguments. argv[0] is the program name and is skipped
+         * @param[out] Result Parsing result. Incomplete in case of error
+         * @return Error of the first rejected argument. Converts to false in case of success
+         *
+         * @throw std::bad_alloc in case of memory allocation failure
+         *
+         * @version 1.0.0
+         * @authors Eugene Azimut
+         */
+        ArgparseError tryParse(int argc, const char *argv[], ParseResult &Result) const;
+
+        /**
+         * @brief Returns registration index of argument with Flag
+         * @param[in] Flag Option with indicator, e.g. "--flag"
+         * @return Index or FlagIndex::NOT_FOUND
+         *
+         * @version 1.0.0
+         * @authors Eugene Azimut
+         */
+        uint32_t indexOf(const StringView &Flag) const;
+
+        /**
+         * @brief Returns registered flags closest to unknown Flag
+         * @details Same as ArgumentParser::getSuggestions(const StringView &, size_t) const
+         *
+         * @param[in] Flag Unknown flag, e.g. "--verbsoe"
+         * @param[in] MaxDistance Maximum distance of suggested flags
+         * @return Flags with the smallest distance not exceeding MaxDistance, in order of registration
+         *
+         * @throw std::bad_alloc in case of memory allocation failure
+         *
+         * @version 1.0.0
+         * @authors Eugene Azimut
+         */
+        std::vector<std::string> getSuggestions(const StringView &Flag, size_t MaxDistance = 2) const;
+
+        /**
+         * @brief Returns registered flags starting with Prefix
+         * @details Same as ArgumentParser::getCandidates(const StringView &) const
+         *
+         * @param[in] Prefix Beginning of flags, e.g. "--verb"
+         * @return Flags in order of registration
+         *
+         * @throw std::bad_alloc in case of memory allocation failure
+         *
+         * @version 1.0.0
+         * @authors Eugene Azimut
+         */
+        std::vector<std::string> getCandidates(const StringView &Prefix) const;
+
+    private:
+        /**
+         * @brief Makes frozen copy of Parser and of parsers of its subcommands
+         * @param[in] Parser Configured parser
+         * @return Frozen parser
+         *
+         * @throw std::bad_alloc in case of memory allocation failure
+         * @throw Exceptions from factories of subcommands
+         *
+         * @version 1.0.0
+         * @authors Eugene Azimut
+         */
+        static std::shared_ptr<ArgumentParser> freeze(const ArgumentParser &Parser);
+
+    //* Variables
+        std::shared_ptr<const ArgumentParser> mParser;  ///< Frozen parser
+    };
+}
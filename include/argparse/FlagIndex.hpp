@@ -0,0 +1,202 @@
+/**
+ * @file FlagIndex.hpp
+ * @brief Declaration of hashed flag index
+ *
+ * @version 1.0.0
+ * @authors Eugene Azimut
+ * @copyright Copyright (c) Eugene Azimut, 2026
+ */
+#pragma once
+#include "api.hpp"
+#include "StringView.hpp"
+
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <vector>
+
+
+
+namespace argparse {
+    /**
+     * @class FlagIndex
+     * @brief Maps flags to argument indices in O(1)
+     * @details Open-addressing hash table with linear probing.
+     * Keys are copied into one contiguous pool when inserted, so the index doesn't depend
+     * on lifetime of the original strings. Lookups don't allocate.\n
+     * The table is kept at most half full and grows only on insertion,
+     * which is expected to happen at registration time
+     *
+     * @version 1.0.0
+     * @authors Eugene Azimut
+     */
+    ARGPARSE_API class FlagIndex {
+    public:
+        /**
+         * @brief Value returned by FlagIndex::find(const StringView &) const for unknown keys
+         *
+         * @version 1.0.0
+         * @authors Eugene Azimut
+         */
+        static constexpr uint32_t NOT_FOUND = UINT32_MAX;
+
+    //* Ctors and dtor
+        /**
+         * @brief Default constructor
+         * @details Creates an empty index
+         *
+         * @version 1.0.0
+         * @authors Eugene Azimut
+         */
+        FlagIndex();
+
+        /**
+         * @brief Copy constructor
+         * @details Creates new index as a copy of Other
+         *
+         * @param[in] Other Instance to copy
+         *
+         * @throw std::bad_alloc in case of memory allocation failure
+         *
+         * @version 1.0.0
+         * @authors Eugene Azimut
+         */
+        FlagIndex(const FlagIndex &Other);
+
+        /**
+         * @brief Move constructor
+         * @details Creates new index moving Other
+         *
+         * @param[in] Other Instance to move
+         *
+         * @version 1.0.0
+         * @authors Eugene Azimut
+         */
+        FlagIndex(FlagIndex &&Other) noexcept;
+
+        /**
+         * @brief Destroies index
+         *
+         * @version 1.0.0
+         * @authors Eugene Azimut
+         */
+        virtual ~FlagIndex() noexcept;
+
+    //* Operators
+        /**
+         * @brief Copy assignment operator
+         * @param[in] Other Instance to copy
+         * @return Reference to this index
+         *
+         * @throw std::bad_alloc in case of memory allocation failure
+         *
+         * @version 1.0.0
+         * @authors Eugene Azimut
+         */
+        FlagIndex &operator=(const FlagIndex &Other) = default;
+
+        /**
+         * @brief Move assignment operator
+         * @param[in] Other Instance to move
+         * @return Reference to this index
+         *
+         * @version 1.0.0
+         * @authors Eugene Azimut
+         */
+        FlagIndex &operator=(FlagIndex &&Other) noexcept = default;
+
+    //* etc
+        /**
+         * @brief Adds Key with associated Value
+         * @param[in] Key Flag, e.g. "--flag"
+         * @param[in] Value Associated value, e.g. index of argument. Cannot be FlagIndex::NOT_FOUND
+         *
+         * @throw std::invalid_argument in case Key is already present
+         * @throw std::bad_alloc in case of memory allocation failure
+         *
+         * @version 1.0.0
+         * @authors Eugene Azimut
+         */
+        void insert(const StringView &Key, uint32_t Value);
+
+        /**
+         * @brief Finds value associated with Key
+         * @param[in] Key Flag to be found
+         * @return Associated value or FlagIndex::NOT_FOUND
+         *
+         * @version 1.0.0
+         * @authors Eugene Azimut
+         */
+        uint32_t find(const StringView &Key) const;
+
+        /**
+         * @brief Returns number of keys
+         * @return Number of keys
+         *
+         * @version 1.0.0
+         * @authors Eugene Azimut
+         */
+        size_t size() const;
+
+        /**
+         * @brief Removes all keys
+         *
+         * @version 1.0.0
+         * @authors Eugene Azimut
+         */
+        void clear();
+
+        /**
+         * @brief Hashes Key
+         * @details 64-bit FNV-1a
+         *
+         * @param[in] Key Sequence to be hashed
+         * @return Hash value
+         *
+         * @version 1.0.0
+         * @authors Eugene Azimut
+         */
+        static uint64_t hash(const StringView &Key);
+
+    private:
+        /**
+         * @struct Slot
+         * @brief Hash table slot
+         *
+         * @version 1.0.0
+         * @authors Eugene Azimut
+         */
+        struct Slot {
+            uint64_t Hash;      ///< Hash of key
+            uint32_t Offset;    ///< Offset of key in pool
+            uint32_t Size;      ///< Size of key
+            uint32_t Value;     ///< Associated value. FlagIndex::NOT_FOUND marks empty slot
+        };
+
+        /**
+         * @brief Finds slot of Key or first empty slot on its probe sequence
+         * @param[in] Key Key to be found
+         * @param[in] Hash Hash of Key
+         * @return Slot index
+         *
+         * @version 1.0.0
+         * @authors Eugene Azimut
+         */
+        size_t probe(const StringView &Key, uint64_t Hash) const;
+
+        /**
+         * @brief Doubles the table and reinserts all keys
+         *
+         * @throw std::bad_alloc in case of memory allocation failure
+         *
+         * @version 1.0.0
+         * @authors Eugene Azimut
+         */
+        void grow();
+
+    //* Variables
+        std::vector<Slot> mSlots;   ///< Hash table. Size is a power of two
+        std::string       mPool;    ///< Contiguous storage of keys
+        size_t            mSize;    ///< Number of keys
+    };
+}
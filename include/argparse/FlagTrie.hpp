@@ -0,0 +1,185 @@
+/**
+ * @file FlagTrie.hpp
+ * @brief Declaration of prefix tree of flags
+ *
+ * @version 1.0.0
+ * @authors Eugene Azimut
+ * @copyright Copyright (c) Eugene Azimut, 2026
+ */
+#pragma once
+#include "api.hpp"
+#include "StringView.hpp"
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+
+
+namespace argparse {
+    /**
+     * @class FlagTrie
+     * @brief Resolves unique prefixes of flags in O(length of prefix)
+     * @details Prefix tree stored in one node array. Every node keeps the value shared
+     * by all keys passing through it, or FlagTrie::AMBIGUOUS if they have different values,
+     * so resolving a prefix is a walk from the root and never visits the subtree.
+     * Children are kept in sibling lists: the number of siblings is bounded by the alphabet,
+     * not by the number of keys. Lookups don't allocate
+     *
+     * @version 1.0.0
+     * @authors Eugene Azimut
+     */
+    ARGPARSE_API class FlagTrie {
+    public:
+        /**
+         * @brief Value returned by FlagTrie::find(const StringView &) const if no key has the prefix
+         *
+         * @version 1.0.0
+         * @authors Eugene Azimut
+         */
+        static constexpr uint32_t NOT_FOUND = UINT32_MAX;
+
+        /**
+         * @brief Value returned by FlagTrie::find(const StringView &) const
+         * if keys with the prefix have different values
+         *
+         * @version 1.0.0
+         * @authors Eugene Azimut
+         */
+        static constexpr uint32_t AMBIGUOUS = UINT32_MAX - 1;
+
+    //* Ctors and dtor
+        /**
+         * @brief Default constructor
+         * @details Creates an empty trie
+         *
+         * @version 1.0.0
+         * @authors Eugene Azimut
+         */
+        FlagTrie();
+
+        /**
+         * @brief Copy constructor
+         * @details Creates new trie as a copy of Other
+         *
+         * @param[in] Other Instance to copy
+         *
+         * @throw std::bad_alloc in case of memory allocation failure
+         *
+         * @version 1.0.0
+         * @authors Eugene Azimut
+         */
+        FlagTrie(const FlagTrie &Other);
+
+        /**
+         * @brief Move constructor
+         * @details Creates new trie moving Other
+         *
+         * @param[in] Other Instance to move
+         *
+         * @version 1.0.0
+         * @authors Eugene Azimut
+         */
+        FlagTrie(FlagTrie &&Other) noexcept;
+
+        /**
+         * @brief Destroies trie
+         *
+         * @version 1.0.0
+         * @authors Eugene Azimut
+         */
+        virtual ~FlagTrie() noexcept;
+
+    //* Operators
+        /**
+         * @brief Copy assignment operator
+         * @param[in] Other Instance to copy
+         * @return Reference to this trie
+         *
+         * @throw std::bad_alloc in case of memory allocation failure
+         *
+         * @version 1.0.0
+         * @authors Eugene Azimut
+         */
+        FlagTrie &operator=(const FlagTrie &Other) = default;
+
+        /**
+         * @brief Move assignment operator
+         * @param[in] Other Instance to move
+         * @return Reference to this trie
+         *
+         * @version 1.0.0
+         * @authors Eugene Azimut
+         */
+        FlagTrie &operator=(FlagTrie &&Other) noexcept = default;
+
+    //* etc
+        /**
+         * @brief Adds Key with associated Value
+         * @param[in] Key Flag, e.g. "--verbose"
+         * @param[in] Value Associated value, e.g. index of argument.
+         * Cannot be FlagTrie::NOT_FOUND or FlagTrie::AMBIGUOUS
+         *
+         * @throw std::invalid_argument in case of invalid Value
+         * @throw std::bad_alloc in case of memory allocation failure
+         *
+         * @version 1.0.0
+         * @authors Eugene Azimut
+         */
+        void insert(const StringView &Key, uint32_t Value);
+
+        /**
+         * @brief Finds value shared by all keys starting with Prefix
+         * @param[in] Prefix Beginning of a key, e.g. "--verb"
+         * @return Shared value, FlagTrie::AMBIGUOUS or FlagTrie::NOT_FOUND
+         *
+         * @version 1.0.0
+         * @authors Eugene Azimut
+         */
+        uint32_t find(const StringView &Prefix) const;
+
+        /**
+         * @brief Returns number of nodes
+         * @return Number of nodes including the root. 0 if the trie is empty
+         *
+         * @version 1.0.0
+         * @authors Eugene Azimut
+         */
+        size_t size() const;
+
+        /**
+         * @brief Removes all keys
+         *
+         * @version 1.0.0
+         * @authors Eugene Azimut
+         */
+        void clear();
+
+    private:
+        /**
+         * @struct Node
+         * @brief Node of prefix tree
+         *
+         * @version 1.0.0
+         * @authors Eugene Azimut
+         */
+        struct Node {
+            uint32_t FirstChild;    ///< Index of the first child or 0
+            uint32_t NextSibling;   ///< Index of the next sibling or 0
+            uint32_t Value;         ///< Value shared by keys of the subtree or FlagTrie::AMBIGUOUS
+            char     Label;         ///< Character of the edge from parent
+        };
+
+        /**
+         * @brief Finds child of Parent labeled Label
+         * @return Index of child or 0
+         *
+         * @version 1.0.0
+         * @authors Eugene Azimut
+         */
+        uint32_t child(uint32_t Parent, char Label) const;
+
+    //* Variables
+        std::vector<Node> mNodes;   ///< Nodes. The root is the first one, 0 in links means none
+    };
+}
@@ -0,0 +1,188 @@
+/**
+ * @file HelpFormatter.hpp
+ * @brief Declaration of help text formatter
+ *
+ * @version 1.0.0
+ * @authors Eugene Azimut
+ * @copyright Copyright (c) Eugene Azimut, 2026
+ */
+#pragma once
+#include "api.hpp"
+#include "StringView.hpp"
+
+#include <cstddef>
+#include <string>
+#include <vector>
+
+
+
+namespace argparse {
+    /**
+     * @class HelpFormatter
+     * @brief Lays out usage, paragraphs and two-column entries in a given width
+     * @details Blocks are collected as views first and rendered at once:
+     * the help column is chosen from all entries and the output buffer
+     * is reserved for the whole text before anything is written into it.
+     * Text is wrapped at spaces, words longer than a line are kept whole
+     *
+     * @version 1.0.0
+     * @authors Eugene Azimut
+     */
+    ARGPARSE_API class HelpFormatter {
+    public:
+        /**
+         * @brief Width used if the terminal width is unknown
+         *
+         * @version 1.0.0
+         * @authors Eugene Azimut
+         */
+        static constexpr size_t DEFAULT_WIDTH = 80;
+
+        /**
+         * @brief Minimum line width. Narrower widths are raised to it
+         *
+         * @version 1.0.0
+         * @authors Eugene Azimut
+         */
+        static constexpr size_t MIN_WIDTH = 40;
+
+        /**
+         * @brief Maximum column at which help of entries starts
+         * @details Entries with longer left column have their help on the next line
+         *
+         * @version 1.0.0
+         * @authors Eugene Azimut
+         */
+        static constexpr size_t MAX_HELP_COLUMN = 30;
+
+    //* Ctors and dtor
+        /**
+         * @brief Default constructor
+         * @details Creates formatter without blocks
+         *
+         * @param[in] Width Maximum line width. Values less than HelpFormatter::MIN_WIDTH are raised to it
+         *
+         * @version 1.0.0
+         * @authors Eugene Azimut
+         */
+        explicit HelpFormatter(size_t Width = DEFAULT_WIDTH);
+
+    //* etc
+        /**
+         * @brief Adds usage line: "usage: Program item item ..."
+         * @details Wrapped lines are aligned after the program name
+         *
+         * @param[in] Program Program name. Must outlive the formatter
+         * @param[in] Items Items of usage, e.g. "[-v]" or "{a,b} ...". Must outlive the formatter
+         *
+         * @throw std::bad_alloc in case of memory allocation failure
+         *
+         * @version 1.0.0
+         * @authors Eugene Azimut
+         */
+        void addUsage(const StringView &Program, const std::vector<std::string> &Items);
+
+        /**
+         * @brief Adds wrapped paragraph preceded by an empty line
+         * @param[in] Text Paragraph. Must outlive the formatter
+         *
+         * @throw std::bad_alloc in case of memory allocation failure
+         *
+         * @version 1.0.0
+         * @authors Eugene Azimut
+         */
+        void addText(const StringView &Text);
+
+        /**
+         * @brief Adds section title preceded by an empty line, e.g. "options:"
+         * @param[in] Title Section title. Must outlive the formatter
+         *
+         * @throw std::bad_alloc in case of memory allocation failure
+         *
+         * @version 1.0.0
+         * @authors Eugene Azimut
+         */
+        void addSection(const StringView &Title);
+
+        /**
+         * @brief Adds entry of a section: left column and wrapped help aligned at the help column
+         * @param[in] Left Left column, e.g. "-j, --jobs N". Must outlive the formatter
+         * @param[in] Help Description. Must outlive the formatter
+         *
+         * @throw std::bad_alloc in case of memory allocation failure
+         *
+         * @version 1.0.0
+         * @authors Eugene Azimut
+         */
+        void addEntry(const StringView &Left, const StringView &Help);
+
+        /**
+         * @brief Renders all blocks
+         * @param[out] Out Rendered text is appended to it
+         *
+         * @throw std::bad_alloc in case of memory allocation failure
+         *
+         * @version 1.0.0
+         * @authors Eugene Azimut
+         */
+        void render(std::string &Out) const;
+
+        /**
+         * @brief Returns width of terminal attached to file descriptor
+         * @details Asks the terminal, then tries the COLUMNS environment variable
+         *
+         * @param[in] Fd File descriptor
+         * @return Number of columns or HelpFormatter::DEFAULT_WIDTH
+         *
+         * @version 1.0.0
+         * @authors Eugene Azimut
+         */
+        static size_t getTerminalWidth(int Fd);
+
+    private:
+        /**
+         * @brief Kind of block
+         *
+         * @version 1.0.0
+         * @authors Eugene Azimut
+         */
+        enum Kind {
+            USAGE,      ///< Usage line
+            TEXT,       ///< Paragraph
+            SECTION,    ///< Section title
+            ENTRY       ///< Entry of section
+        };
+
+        /**
+         * @struct Block
+         * @brief Part of help text
+         *
+         * @version 1.0.0
+         * @authors Eugene Azimut
+         */
+        struct Block {
+            Kind       Type;        ///< Kind of block
+            StringView Left;        ///< Program name, section title or left column
+            StringView Text;        ///< Paragraph or help of entry
+            const std::vector<std::string> *Items;  ///< Items of usage
+        };
+
+        /**
+         * @brief Appends Text wrapped into [Indent, mWidth) columns
+         * @details The first line continues the current one which is Column characters long
+         *
+         * @param[out] Out Output text
+         * @param[in] Text Wrapped text
+         * @param[in] Column Length of the current line
+         * @param[in] Indent Indent of the next lines
+         *
+         * @version 1.0.0
+         * @authors Eugene Azimut
+         */
+        void wrap(std::string &Out, const StringView &Text, size_t Column, size_t Indent) const;
+
+    //* Variables
+        size_t mWidth;                  ///< Maximum line width
+        std::vector<Block> mBlocks;     ///< Blocks in order of addition
+    };
+}
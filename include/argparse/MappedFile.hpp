@@ -0,0 +1,144 @@
+/**
+ * @file MappedFile.hpp
+ * @brief Declaration of memory-mapped file
+ *
+ * @version 1.0.0
+ * @authors Eugene Azimut
+ * @copyright Copyright (c) Eugene Azimut, 2026
+ */
+#pragma once
+#include "api.hpp"
+
+#include <cstddef>
+#include <string>
+
+
+
+namespace argparse {
+    /**
+     * @class MappedFile
+     * @brief Private (copy-on-write) memory mapping of a whole file
+     * @details The mapping is writable: changes are visible only to the process
+     * and are never written back to the file. Only touched pages are copied,
+     * so the contents can be rewritten in place without copying the whole file
+     *
+     * @version 1.0.0
+     * @authors Eugene Azimut
+     */
+    ARGPARSE_API class MappedFile {
+    public:
+    //* Ctors and dtor
+        /**
+         * @brief Default constructor
+         * @details Creates an empty instance, nothing is mapped
+         *
+         * @version 1.0.0
+         * @authors Eugene Azimut
+         */
+        MappedFile();
+
+        /**
+         * @brief Copying is prohibited: the mapping is owned by one instance
+         *
+         * @version 1.0.0
+         * @authors Eugene Azimut
+         */
+        MappedFile(const MappedFile &Other) = delete;
+
+        /**
+         * @brief Move constructor
+         * @details Takes over the mapping of Other. Other becomes empty
+         *
+         * @param[in] Other Instance to move
+         *
+         * @version 1.0.0
+         * @authors Eugene Azimut
+         */
+        MappedFile(MappedFile &&Other) noexcept;
+
+        /**
+         * @brief Checks whether or not Path names no file at all
+         * @details Tells a missing file from one which exists but can't be read
+         * after MappedFile::map(const std::string &) failed
+         *
+         * @param[in] Path Path to file
+         * @return true if Path or one of its directories doesn't exist
+         *
+         * @version 1.0.0
+         * @authors Eugene Azimut
+         */
+        static bool isMissing(const std::string &Path) noexcept;
+
+        /**
+         * @brief Unmaps the file
+         *
+         * @version 1.0.0
+         * @authors Eugene Azimut
+         */
+        virtual ~MappedFile() noexcept;
+
+    //* Operators
+        /**
+         * @brief Copying is prohibited: the mapping is owned by one instance
+         *
+         * @version 1.0.0
+         * @authors Eugene Azimut
+         */
+        MappedFile &operator=(const MappedFile &Other) = delete;
+
+        /**
+         * @brief Move assignment operator
+         * @details Unmaps own file and takes over the mapping of Other
+         *
+         * @param[in] Other Instance to move
+         * @return Reference to this instance
+         *
+         * @version 1.0.0
+         * @authors Eugene Azimut
+         */
+        MappedFile &operator=(MappedFile &&Other) noexcept;
+
+    //* Getters
+        /**
+         * @brief Returns mapped contents
+         * @return Pointer to the first byte. nullptr if nothing is mapped or the file is empty
+         *
+         * @version 1.0.0
+         * @authors Eugene Azimut
+         */
+        char *data() const;
+
+        /**
+         * @brief Returns size of mapped contents
+         * @return Size in bytes
+         *
+         * @version 1.0.0
+         * @authors Eugene Azimut
+         */
+        size_t size() const;
+
+    //* etc
+        /**
+         * @brief Maps file at Path, unmapping the previous one
+         * @param[in] Path Path to file
+         * @return Whether or not the file was mapped. Empty files are mapped successfully
+         *
+         * @version 1.0.0
+         * @authors Eugene Azimut
+         */
+        bool map(const std::string &Path) noexcept;
+
+        /**
+         * @brief Unmaps the file
+         *
+         * @version 1.0.0
+         * @authors Eugene Azimut
+         */
+        void unmap() noexcept;
+
+    private:
+    //* Variables
+        char  *mData;   ///< Mapped contents
+        size_t mSize;   ///< Size of mapped contents
+    };
+}
@@ -8,6 +8,9 @@
  */
 #pragma once
 #include "../api.hpp"
+#include "../ArgparseError.hpp"
+#include "../StringView.hpp"
+#include "Token.hpp"
 
 #include <string>
 #include <stdexcept>
@@ -145,7 +148,8 @@ namespace argparse {
             /**
              * @brief Splits Arg into Option and Value if possible
              * @details This method tries to split argument into Option and Value
-             * using predefined indicator and delimiter.
+             * using predefined indicator and delimiter.\n
+             * It is a copying wrapper over OptionStyle::tryTokenize(const StringView &, Token &) const
              *
              * @note Strong exception guarantee!\n
              * Option and Value will not be touched in case of exceptions
@@ -155,7 +159,7 @@ namespace argparse {
              * @param[out] Value Value without delimiter
              *
              * @throw std::bad_alloc in case of memory allocation failure
-             * TODO: ArgparseError
+             * @throw std::runtime_error in case Arg isn't a valid option
              *
              * @version 1.0.0
              * @authors Eugene Azimut
@@ -166,6 +170,76 @@ namespace argparse {
                 std::string &Value
             ) const;
 
+            /**
+             * @brief Splits Arg into Option and Value without copying and throwing
+             * @details Non-throwing version of OptionStyle::splitArg(const std::string &, std::string &, std::string &)
+             *
+             * @param[in] Arg Argument to be splitted
+             * @param[out] Option Option without indicator. Untouched in case of error
+             * @param[out] Value Value without delimiter. Untouched in case of error
+             * @return ErrorCode::SUCCESS or error code. ErrorCode::NOT_AN_OPTION if Arg isn't an option,
+             * ErrorCode::INVALID_OPTION if Arg is the end of options marker
+             *
+             * @version 1.0.0
+             * @authors Eugene Azimut
+             */
+            ErrorCode trySplitArg(const StringView &Arg, StringView &Option, StringView &Value) const noexcept;
+
+            /**
+             * @brief Splits Arg into token without copying
+             * @details Throwing wrapper over OptionStyle::tryTokenize(const StringView &, Token &) const
+             *
+             * @param[in] Arg Argument to be splitted
+             * @return Token with views into Arg
+             *
+             * @throw std::runtime_error in case Arg looks like an option but is malformed
+             *
+             * @version 1.0.0
+             * @authors Eugene Azimut
+             */
+            Token tokenize(const StringView &Arg) const;
+
+            /**
+             * @brief Splits Arg into token without copying and throwing
+             * @details Zero-copy version of OptionStyle::splitArg(const std::string &, std::string &, std::string &).
+             * All views of the token point into Arg memory, nothing is allocated
+             * even if an error is reported.\n
+             * Arguments that aren't options are returned as TokenKind::POSITIONAL
+             * without an error.\n
+             * Option styles override this method. Arguments which don't start with
+             * the first character of the indicator must be returned as TokenKind::POSITIONAL:
+             * parsers skip tokenizing of such arguments,
+             * see OptionStyle::classify(const char *const [], size_t, TokenClass []) const
+             *
+             * @param[in] Arg Argument to be splitted
+             * @param[out] Tok Token with views into Arg. Unspecified in case of error
+             * @return ErrorCode::SUCCESS or error code in case Arg looks like an option but is malformed
+             *
+             * @version 1.0.0
+             * @authors Eugene Azimut
+             */
+            virtual ErrorCode tryTokenize(const StringView &Arg, Token &Tok) const noexcept;
+
+            /**
+             * @brief Classifies Count null-terminated arguments in one pass
+             * @details Every argument is scanned once for its terminator,
+             * 32 (AVX2) or 16 (SSE2) bytes at a time with a scalar fallback on other platforms.
+             * Value delimiters are left to OptionStyle::tryTokenize(const StringView &, Token &) const,
+             * which styles override.
+             * Arguments which don't start with the first character of the indicator
+             * are classified as TokenKind::POSITIONAL, the rest as TokenKind::OPTION
+             * and have to be tokenized.\n
+             * Nothing is allocated
+             *
+             * @param[in] Args Null-terminated arguments
+             * @param[in] Count Number of arguments
+             * @param[out] Classes Array of at least Count records
+             *
+             * @version 1.0.0
+             * @authors Eugene Azimut
+             */
+            void classify(const char *const Args[], size_t Count, TokenClass Classes[]) const noexcept;
+
         private:
             std::string mIndicator;     ///< Option indicator
             std::string mValueDelim;    ///< Value delimiter
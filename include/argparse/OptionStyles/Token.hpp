@@ -0,0 +1,86 @@
+/**
+ * @file Token.hpp
+ * @brief Declaration of CLI token produced by option styles
+ *
+ * @version 1.0.0
+ * @authors Eugene Azimut
+ * @copyright Copyright (c) Eugene Azimut, 2026
+ */
+#pragma once
+#include "../api.hpp"
+#include "../StringView.hpp"
+
+#include <cstddef>
+#include <cstdint>
+
+
+
+namespace argparse {
+    namespace OptStyles {
+        /**
+         * @brief Kinds of CLI tokens
+         * @details Values:\n
+         * * "POSITIONAL"   - argument isn't an option, e.g. "file.txt"\n
+         * * "OPTION"       - option of a style without short/long distinction, e.g. "/flag:value"\n
+         * * "SHORT_OPTION" - short option, e.g. "-f" or "-fvalue"\n
+         * * "LONG_OPTION"  - long option, e.g. "--flag" or "--flag=value"\n
+         * * "TERMINATOR"   - end of options marker, e.g. "--"
+         *
+         * @version 1.0.0
+         * @authors Eugene Azimut
+         */
+        ARGPARSE_API enum TokenKind: uint8_t {
+            POSITIONAL      = 0u,   ///< Not an option
+            OPTION          = 1u,   ///< Option of a style without short/long distinction
+            SHORT_OPTION    = 2u,   ///< Short option
+            LONG_OPTION     = 3u,   ///< Long option
+            TERMINATOR      = 4u    ///< End of options marker
+        };
+
+        /**
+         * @struct Token
+         * @brief Result of splitting one CLI argument
+         * @details All views point into the original argument memory (usually argv),
+         * so producing a token allocates nothing.\n
+         * Example for "--flag=value" in UnixStyle:
+         * @code
+         *     Kind     = LONG_OPTION
+         *     Flag     = "--flag"
+         *     Option   = "flag"
+         *     Value    = "value"
+         *     HasValue = true
+         * @endcode
+         * For POSITIONAL tokens Value views the whole argument
+         *
+         * @warning Views are valid as long as the tokenized argument is alive
+         *
+         * @version 1.0.0
+         * @authors Eugene Azimut
+         */
+        struct Token {
+            TokenKind  Kind     = POSITIONAL;   ///< Kind of token
+            StringView Flag;                    ///< Option with indicator
+            StringView Option;                  ///< Option without indicator
+            StringView Value;                   ///< Value without delimiter
+            bool       HasValue = false;        ///< Whether or not value was attached to option
+        };
+
+        /**
+         * @struct TokenClass
+         * @brief Result of the classification pass over one CLI argument
+         * @details Produced by OptionStyle::classify(const char *const [], size_t, TokenClass []) const
+         * without splitting the argument:
+         *   * Kind is TokenKind::POSITIONAL if the argument can't be an option
+         *     and TokenKind::OPTION if it has to be tokenized;
+         *   * Length is the argument length. Arguments are limited by the operating system
+         *     far below 4 GiB, so 32 bits are enough and the record stays 8 bytes long
+         *
+         * @version 1.0.0
+         * @authors Eugene Azimut
+         */
+        struct TokenClass {
+            uint32_t  Length;       ///< Length of argument
+            TokenKind Kind;         ///< TokenKind::POSITIONAL or TokenKind::OPTION
+        };
+    }
+}
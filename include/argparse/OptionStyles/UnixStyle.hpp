@@ -83,29 +83,19 @@ namespace argparse {
             virtual bool isArgOptional(const std::string &Arg) const override;
 
             /**
-             * @brief Splits Arg into Option and Value if possible
-             * @details This method tries to split argument into Option and Value
-             * using predefined indicator and delimiter.
-             *
-             * @note Strong exception guarantee!\n
-             * Option and Value will not be touched in case of exceptions
+             * @brief Splits Arg into token without copying and throwing
+             * @details Recognizes short options ("-f", "-fvalue"),
+             * long options ("--flag", "--flag=value") and the end of options marker ("--").
+             * All views of the token point into Arg memory
              *
              * @param[in] Arg Argument to be splitted
-             * @param[out] Option Option without indicator
-             * @param[out] Value Value without delimiter
-             *
-             * @throw std::bad_alloc in case of memory allocation failure
-             * TODO: ArgparseError
-             * @throw Exceptions from OptionStyle::splitArg(const std::string &, std::string &, std::string &)
+             * @param[out] Tok Token with views into Arg. Unspecified in case of error
+             * @return ErrorCode::SUCCESS or error code in case Arg looks like an option but is malformed
              *
              * @version 1.0.0
              * @authors Eugene Azimut
              */
-            virtual void splitArg(
-                const std::string &Arg,
-                std::string &Option,
-                std::string &Value
-            ) const override;
+            virtual ErrorCode tryTokenize(const StringView &Arg, Token &Tok) const noexcept override;
 
         protected:
             using OptionStyle::setIndicator;
@@ -0,0 +1,370 @@
+/**
+ * @file ParseResult.hpp
+ * @brief Declaration of CLI parsing result
+ *
+ * @version 1.0.0
+ * @authors Eugene Azimut
+ * @copyright Copyright (c) Eugene Azimut, 2026
+ */
+#pragma once
+#include "api.hpp"
+#include "Arena.hpp"
+#include "MappedFile.hpp"
+#include "StringView.hpp"
+
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <string>
+#include <vector>
+
+
+
+namespace argparse {
+    class ArgumentParser;
+
+    /**
+     * @class ParseResult
+     * @brief Everything collected by one ArgumentParser::parse call
+     * @details For every registered argument (by its registration index) keeps
+     * occurrences and consumed values in command-line order.
+     * All storage comes from the result arena, which is reset (not freed) when the
+     * result is reused, so parsing command lines of the same size into the same result
+     * doesn't touch the heap.\n
+     * Values are views into argv: they are valid as long as argv is alive.
+     * Values read from response files are views into file mappings owned by the result:
+     * they are valid until the result is cleared, reused or destroyed.\n
+     * Arguments of a selected subcommand are collected into a nested result,
+     * see ParseResult::getSubcommandResult() const
+     *
+     * @version 1.0.0
+     * @authors Eugene Azimut
+     */
+    ARGPARSE_API class ParseResult {
+    private:
+        /**
+         * @struct Event
+         * @brief Occurrence of an argument or one of its values
+         *
+         * @version 1.0.0
+         * @authors Eugene Azimut
+         */
+        struct Event {
+            Event     *Next;        ///< Next event of the same argument
+            StringView Value;       ///< Consumed value. Unused for occurrences
+            bool       IsValue;     ///< Whether the event is a value or an occurrence
+        };
+
+        /**
+         * @struct Slot
+         * @brief Events of one argument
+         *
+         * @version 1.0.0
+         * @authors Eugene Azimut
+         */
+        struct Slot {
+            uint32_t Count;         ///< Number of occurrences
+            uint32_t ValuesCount;   ///< Number of values
+            Event   *First;         ///< First event
+            Event   *Last;          ///< Last event
+        };
+
+    public:
+        /**
+         * @class ValueIterator
+         * @brief Forward iterator over values of one argument
+         *
+         * @version 1.0.0
+         * @authors Eugene Azimut
+         */
+        class ValueIterator {
+        public:
+            /**
+             * @brief Creates iterator pointing at first value event starting from Current
+             * @param[in] Current Event to start from
+             *
+             * @version 1.0.0
+             * @authors Eugene Azimut
+             */
+            explicit ValueIterator(const Event *Current = nullptr);
+
+            /**
+             * @brief Returns current value
+             * @return View of value
+             *
+             * @version 1.0.0
+             * @authors Eugene Azimut
+             */
+            const StringView &operator*() const;
+
+            /**
+             * @brief Advances to the next value
+             * @return Reference to this iterator
+             *
+             * @version 1.0.0
+             * @authors Eugene Azimut
+             */
+            ValueIterator &operator++();
+
+            /**
+             * @brief Compares iterators
+             *
+             * @version 1.0.0
+             * @authors Eugene Azimut
+             */
+            bool operator!=(const ValueIterator &Other) const;
+
+        private:
+            const Event *mCurrent;  ///< Current value event
+        };
+
+        /**
+         * @struct ValueRange
+         * @brief Range of values usable in range-based for
+         *
+         * @version 1.0.0
+         * @authors Eugene Azimut
+         */
+        struct ValueRange {
+            ValueIterator First;    ///< Iterator to the first value
+
+            /**
+             * @brief Returns iterator to the first value
+             */
+            ValueIterator begin() const { return First; }
+
+            /**
+             * @brief Returns past-the-end iterator
+             */
+            ValueIterator end() const { return ValueIterator(); }
+        };
+
+    //* Ctors and dtor
+        /**
+         * @brief Default constructor
+         * @details Creates an empty result
+         *
+         * @param[in] ArenaBlockSize Size of the first arena block in bytes
+         *
+         * @version 1.0.0
+         * @authors Eugene Azimut
+         */
+        explicit ParseResult(size_t ArenaBlockSize = Arena::DEFAULT_BLOCK_SIZE);
+
+        /**
+         * @brief Copying is prohibited: collected data lives in the arena
+         *
+         * @version 1.0.0
+         * @authors Eugene Azimut
+         */
+        ParseResult(const ParseResult &Other) = delete;
+
+        /**
+         * @brief Move constructor
+         * @details Takes over collected data of Other. Other becomes empty
+         *
+         * @param[in] Other Instance to move
+         *
+         * @version 1.0.0
+         * @authors Eugene Azimut
+         */
+        ParseResult(ParseResult &&Other) noexcept;
+
+        /**
+         * @brief Destroies result
+         *
+         * @version 1.0.0
+         * @authors Eugene Azimut
+         */
+        virtual ~ParseResult() noexcept;
+
+    //* Getters
+        /**
+         * @brief Returns number of arguments known to the result
+         * @return Number of registered arguments at the time of parsing
+         *
+         * @version 1.0.0
+         * @authors Eugene Azimut
+         */
+        size_t size() const;
+
+        /**
+         * @brief Returns how many times argument was recognized
+         * @param[in] Index Registration index of argument
+         * @return Number of occurrences
+         *
+         * @throw std::out_of_range in case of invalid Index
+         *
+         * @version 1.0.0
+         * @authors Eugene Azimut
+         */
+        uint32_t getCount(size_t Index) const;
+
+        /**
+         * @brief Returns number of values consumed by argument
+         * @param[in] Index Registration index of argument
+         * @return Number of values in all occurrences
+         *
+         * @throw std::out_of_range in case of invalid Index
+         *
+         * @version 1.0.0
+         * @authors Eugene Azimut
+         */
+        uint32_t getValuesCount(size_t Index) const;
+
+        /**
+         * @brief Returns values consumed by argument in command-line order
+         * @param[in] Index Registration index of argument
+         * @return Range of value views
+         *
+         * @throw std::out_of_range in case of invalid Index
+         *
+         * @version 1.0.0
+         * @authors Eugene Azimut
+         */
+        ValueRange getValues(size_t Index) const;
+
+        /**
+         * @brief Returns arena serving the result
+         * @details Can be used for additional per-parse allocations
+         * which should be released together with the result
+         *
+         * @return Arena
+         *
+         * @version 1.0.0
+         * @authors Eugene Azimut
+         */
+        Arena &getArena();
+
+        /**
+         * @brief Returns name of selected subcommand
+         * @return View of subcommand name in argv. Empty if no subcommand was selected
+         *
+         * @version 1.0.0
+         * @authors Eugene Azimut
+         */
+        const StringView &getSubcommand() const;
+
+        /**
+         * @brief Returns result of selected subcommand
+         * @details Arguments of the subcommand are identified by their registration index
+         * in the subcommand parser
+         *
+         * @return Nested parsing result
+         *
+         * @throw std::logic_error in case no subcommand was selected
+         *
+         * @version 1.0.0
+         * @authors Eugene Azimut
+         */
+        const ParseResult &getSubcommandResult() const;
+
+    //* etc
+        /**
+         * @brief Forgets collected data, resets the arena and unmaps response files
+         *
+         * @version 1.0.0
+         * @authors Eugene Azimut
+         */
+        void clear();
+
+    private:
+        friend class ArgumentParser;
+
+        /**
+         * @brief Prepares result for parsing
+         * @details Resets the arena and allocates empty slots from it
+         *
+         * @param[in] ArgumentsCount Number of registered arguments
+         *
+         * @throw std::bad_alloc in case of memory allocation failure
+         *
+         * @version 1.0.0
+         * @authors Eugene Azimut
+         */
+        void begin(size_t ArgumentsCount);
+
+        /**
+         * @brief Records occurrence of argument
+         * @details Also sets the argument bit in the set of seen arguments
+         *
+         * @param[in] Index Registration index of argument
+         *
+         * @throw std::bad_alloc in case of memory allocation failure
+         *
+         * @version 1.0.0
+         * @authors Eugene Azimut
+         */
+        void addOccurrence(size_t Index);
+
+        /**
+         * @brief Records value of argument
+         * @param[in] Index Registration index of argument
+         * @param[in] Value View of value
+         *
+         * @throw std::bad_alloc in case of memory allocation failure
+         *
+         * @version 1.0.0
+         * @authors Eugene Azimut
+         */
+        void addValue(size_t Index, const StringView &Value);
+
+        /**
+         * @brief Appends event to argument slot
+         *
+         * @throw std::bad_alloc in case of memory allocation failure
+         *
+         * @version 1.0.0
+         * @authors Eugene Azimut
+         */
+        void addEvent(size_t Index, const StringView &Value, bool IsValue);
+
+        /**
+         * @brief Maps response file and keeps the mapping until the result is cleared
+         * @param[in] Path Path to file
+         * @return Mapping or nullptr if the file can't be mapped
+         *
+         * @throw std::bad_alloc in case of memory allocation failure
+         *
+         * @version 1.0.0
+         * @authors Eugene Azimut
+         */
+        MappedFile *mapFile(const std::string &Path);
+
+        /**
+         * @brief Records selected subcommand
+         * @details The nested result is created by the first selection and reused later
+         *
+         * @param[in] Index Registration index of subcommand
+         * @param[in] Name View of subcommand name
+         * @return Nested result for arguments of the subcommand
+         *
+         * @throw std::bad_alloc in case of memory allocation failure
+         *
+         * @version 1.0.0
+         * @authors Eugene Azimut
+         */
+        ParseResult &selectSubcommand(uint32_t Index, const StringView &Name);
+
+        /**
+         * @brief Returns slot of argument
+         *
+         * @throw std::out_of_range in case of invalid Index
+         *
+         * @version 1.0.0
+         * @authors Eugene Azimut
+         */
+        const Slot &getSlot(size_t Index) const;
+
+    //* Variables
+        Arena  mArena;                      ///< Storage of slots and events
+        Slot  *mSlots;                      ///< Slot for every registered argument
+        size_t mSize;                       ///< Number of slots
+        std::vector<MappedFile> mFiles;     ///< Response files referenced by values
+        uint64_t  *mSeen;                   ///< Bit of every argument which occurred at least once
+        size_t     mSeenWords;              ///< Number of words in mSeen
+        uint32_t   mSubcommand;             ///< Registration index of selected subcommand or UINT32_MAX
+        StringView mSubcommandName;         ///< Name of selected subcommand
+        std::unique_ptr<ParseResult> mSubcommandResult;     ///< Result of subcommand, kept for reuse
+    };
+}
@@ -0,0 +1,404 @@
+/**
+ * @file StaticParser.hpp
+ * @brief Declaration of compile-time CLI parser schemas
+ * @details Unlike the rest of the library, this header requires C++14:
+ * C++11 constexpr functions cannot contain loops needed to build the flag table
+ *
+ * @version 1.0.0
+ * @authors Eugene Azimut
+ * @copyright Copyright (c) Eugene Azimut, 2026
+ */
+#pragma once
+#include "api.hpp"
+
+#if __cplusplus < 201402L
+    #error "argparse/StaticParser.hpp requires C++14 and higher"
+#endif
+
+#include "StringView.hpp"
+#include "OptionStyles/UnixStyle.hpp"
+#include "args/NARGS.hpp"
+
+#include <cstddef>
+#include <cstdint>
+#include <stdexcept>
+#include <string>
+
+
+
+namespace argparse {
+    /**
+     * @struct StaticOption
+     * @brief Compile-time descriptor of optional CLI argument
+     * @details Example:
+     * @code {.cpp}
+     *     constexpr StaticOption Options[] = {
+     *         StaticOption("-v", "--verbose"),
+     *         StaticOption("-o", "--output", 1, "a.out"),
+     *         StaticOption(nullptr, "--color", NARGS::ZERO_OR_ONE, "auto")
+     *     };
+     * @endcode
+     *
+     * @version 1.0.0
+     * @authors Eugene Azimut
+     */
+    struct StaticOption {
+        StringView Short;       ///< Short flag, e.g. "-v". May be empty
+        StringView Long;        ///< Long flag, e.g. "--verbose". May be empty
+        uint32_t   NArgs;       ///< One of: 0, 1, NARGS::NO_MORE, NARGS::ZERO_OR_ONE
+        StringView Default;     ///< Value if option wasn't recognized
+
+        /**
+         * @brief Creates empty option descriptor
+         *
+         * @version 1.0.0
+         * @authors Eugene Azimut
+         */
+        constexpr StaticOption():
+        Short(), Long(), NArgs(args::NARGS::NO_MORE), Default() {}
+
+        /**
+         * @brief Creates option descriptor
+         * @param[in] ShortFlag Short flag or nullptr
+         * @param[in] LongFlag Long flag or nullptr
+         * @param[in] NArgs_ The number of command-line arguments that should be consumed
+         * @param[in] DefaultValue Value if option wasn't recognized
+         *
+         * @version 1.0.0
+         * @authors Eugene Azimut
+         */
+        constexpr StaticOption(
+            const char *ShortFlag,
+            const char *LongFlag,
+            uint32_t NArgs_ = args::NARGS::NO_MORE,
+            const char *DefaultValue = nullptr
+        ):
+        Short(ShortFlag), Long(LongFlag), NArgs(NArgs_), Default(DefaultValue) {}
+    };
+
+    /**
+     * @struct StaticResult
+     * @brief Result of StaticParser::parse(int, const char *[], StaticResult<N> &) const
+     * @details Fixed-size storage, nothing is allocated.
+     * Values are views into argv or into StaticOption::Default
+     *
+     * @tparam N Number of options in schema
+     *
+     * @version 1.0.0
+     * @authors Eugene Azimut
+     */
+    template<size_t N>
+    struct StaticResult {
+        uint32_t   Count[N];        ///< How many times each option was recognized
+        StringView Value[N];        ///< Last value of each option or its default
+        int        Positional = 0;  ///< Index of the first positional argument in argv (argc if none)
+    };
+
+    /**
+     * @class StaticParser
+     * @brief CLI parser whose schema is built at compile time
+     * @details The flag table (open addressing over FNV-1a hashes) is built by the
+     * constexpr constructor, so declaring the parser constexpr moves all registration work
+     * into compilation. Invalid schemas don't compile:
+     *   * duplicate flags;
+     *   * options without flags;
+     *   * NArgs other than 0, 1, NARGS::NO_MORE and NARGS::ZERO_OR_ONE
+     *
+     * Parsing uses Unix option style and performs no virtual calls and no allocations
+     * except when an error is reported.\n
+     * Options are parsed until the first positional argument or "--", like POSIX getopt:
+     * @code {.cpp}
+     *     constexpr StaticParser<3> Parser(Options);
+     *
+     *     StaticResult<3> Result;
+     *     Parser.parse(argc, argv, Result);
+     *     bool Verbose  = Parser.count(Result, "--verbose") > 0;
+     *     StringView Output = Parser.value(Result, "--output");
+     *     // Positional arguments: argv[Result.Positional..argc)
+     * @endcode
+     *
+     * @tparam N Number of options in schema
+     *
+     * @version 1.0.0
+     * @authors Eugene Azimut
+     */
+    template<size_t N>
+    class StaticParser {
+    public:
+        /**
+         * @brief Value returned by StaticParser::indexOf(const StringView &) const for unknown flags
+         *
+         * @version 1.0.0
+         * @authors Eugene Azimut
+         */
+        static constexpr size_t NOT_FOUND = N;
+
+    //* Ctors
+        /**
+         * @brief Builds parser from schema
+         * @param[in] Options Schema
+         *
+         * @throw std::logic_error in case of invalid schema.
+         * In constant evaluation it is a compilation error
+         *
+         * @version 1.0.0
+         * @authors Eugene Azimut
+         */
+        constexpr explicit StaticParser(const StaticOption (&Options)[N]):
+        mOptions(), mSlots() {
+            for (size_t i = 0; i < N; ++i) {
+                const StaticOption &Opt = Options[i];
+                if (
+                    Opt.NArgs != 1 &&
+                    Opt.NArgs != args::NARGS::NO_MORE &&
+                    Opt.NArgs != args::NARGS::ZERO_OR_ONE
+                ) {
+                    throw std::logic_error("argparse::StaticParser: invalid NArgs value");
+                }
+                if (Opt.Short.empty() && Opt.Long.empty()) {
+                    throw std::logic_error("argparse::StaticParser: option without flags");
+                }
+
+                mOptions[i] = Opt;
+                if (!Opt.Short.empty()) insert(Opt.Short, i);
+                if (!Opt.Long.empty())  insert(Opt.Long, i);
+            }
+        }
+
+    //* etc
+        /**
+         * @brief Returns index of option with Flag
+         * @param[in] Flag Flag with indicator, e.g. "--verbose"
+         * @return Index in schema or StaticParser::NOT_FOUND
+         *
+         * @version 1.0.0
+         * @authors Eugene Azimut
+         */
+        constexpr size_t indexOf(const StringView &Flag) const {
+            const size_t Slot = probe(Flag);
+            return mSlots[Slot] == 0 ? NOT_FOUND : mSlots[Slot] - 1;
+        }
+
+        /**
+         * @brief Returns how many times option with Flag was recognized
+         * @param[in] Result Parsing result
+         * @param[in] Flag Flag with indicator
+         * @return Number of occurrences
+         *
+         * @throw std::invalid_argument in case of unknown Flag
+         *
+         * @version 1.0.0
+         * @authors Eugene Azimut
+         */
+        uint32_t count(const StaticResult<N> &Result, const StringView &Flag) const {
+            return Result.Count[checkedIndexOf(Flag)];
+        }
+
+        /**
+         * @brief Returns value of option with Flag
+         * @param[in] Result Parsing result
+         * @param[in] Flag Flag with indicator
+         * @return Last value or default value
+         *
+         * @throw std::invalid_argument in case of unknown Flag
+         *
+         * @version 1.0.0
+         * @authors Eugene Azimut
+         */
+        StringView value(const StaticResult<N> &Result, const StringView &Flag) const {
+            return Result.Value[checkedIndexOf(Flag)];
+        }
+
+        /**
+         * @brief Parses CLI arguments
+         * @param[in] argc Number of CLI arguments
+         * @param[in] argv CLI arguments. argv[0] is the program name and is skipped
+         * @param[out] Result Parsing result
+         *
+         * @throw std::runtime_error in case of malformed, unrecognized or missing arguments
+         *
+         * @version 1.0.0
+         * @authors Eugene Azimut
+         */
+        void parse(int argc, const char *argv[], StaticResult<N> &Result) const {
+            static const OptStyles::UnixStyle Style;
+
+            for (size_t i = 0; i < N; ++i) {
+                Result.Count[i] = 0;
+                Result.Value[i] = mOptions[i].Default;
+            }
+            Result.Positional = argc;
+
+            for (int i = 1; i < argc; ++i) {
+                const StringView Arg(argv[i]);
+                const OptStyles::Token Tok = Style.tokenize(Arg);
+
+                if (Tok.Kind == OptStyles::POSITIONAL) {
+                    Result.Positional = i;
+                    return;
+                }
+                if (Tok.Kind == OptStyles::TERMINATOR) {
+                    Result.Positional = i + 1;
+                    return;
+                }
+
+                const size_t Index = indexOf(Tok.Flag);
+                if (Index == NOT_FOUND) {
+                    throw std::runtime_error(error("unrecognized option", Tok.Flag));
+                }
+                const uint32_t NArgs = mOptions[Index].NArgs;
+
+                ++Result.Count[Index];
+                if (Tok.HasValue) {
+                    if (NArgs == args::NARGS::NO_MORE) {
+                        throw std::runtime_error(error("option doesn't accept values", Tok.Flag));
+                    }
+                    Result.Value[Index] = Tok.Value;
+                } else if (NArgs != args::NARGS::NO_MORE && i + 1 < argc) {
+                    const StringView Next(argv[i + 1]);
+                    if (Style.tokenize(Next).Kind == OptStyles::POSITIONAL) {
+                        Result.Value[Index] = Next;
+                        ++i;
+                    } else if (NArgs == 1) {
+                        throw std::runtime_error(error("expected value for option", Tok.Flag));
+                    }
+                } else if (NArgs == 1) {
+                    throw std::runtime_error(error("expected value for option", Tok.Flag));
+                }
+            }
+        }
+
+    private:
+        /**
+         * @brief Number of table slots: power of two keeping the table at most half full
+         *
+         * @version 1.0.0
+         * @authors Eugene Azimut
+         */
+        static constexpr size_t tableSize() {
+            size_t Size = 4;
+            while (Size < N * 4) Size *= 2;
+            return Size;
+        }
+
+        static constexpr size_t TABLE_SIZE = tableSize();   ///< Number of table slots
+
+        /**
+         * @brief constexpr 64-bit FNV-1a hash
+         *
+         * @version 1.0.0
+         * @authors Eugene Azimut
+         */
+        static constexpr uint64_t hash(const StringView &Key) {
+            uint64_t Hash = 14695981039346656037ull;
+            for (size_t i = 0; i < Key.size(); ++i) {
+                Hash ^= static_cast<unsigned char>(Key[i]);
+                Hash *= 1099511628211ull;
+            }
+            return Hash;
+        }
+
+        /**
+         * @brief Compares views in constant expressions
+         *
+         * @version 1.0.0
+         * @authors Eugene Azimut
+         */
+        static constexpr bool equals(const StringView &Left, const StringView &Right) {
+            if (Left.size() != Right.size()) return false;
+            for (size_t i = 0; i < Left.size(); ++i) {
+                if (Left[i] != Right[i]) return false;
+            }
+            return true;
+        }
+
+        /**
+         * @brief Returns slot holding Flag or first empty slot on its probe sequence
+         *
+         * @version 1.0.0
+         * @authors Eugene Azimut
+         */
+        constexpr size_t probe(const StringView &Flag) const {
+            size_t Slot = static_cast<size_t>(hash(Flag)) & (TABLE_SIZE - 1);
+            while (mSlots[Slot] != 0) {
+                const StaticOption &Opt = mOptions[mSlots[Slot] - 1];
+                if (equals(Opt.Short, Flag) || equals(Opt.Long, Flag)) break;
+                Slot = (Slot + 1) & (TABLE_SIZE - 1);
+            }
+            return Slot;
+        }
+
+        /**
+         * @brief Adds Flag of option Index to the table
+         *
+         * @throw std::logic_error in case of duplicate flag
+         *
+         * @version 1.0.0
+         * @authors Eugene Azimut
+         */
+        constexpr void insert(const StringView &Flag, size_t Index) {
+            const size_t Slot = probe(Flag);
+            if (mSlots[Slot] != 0) {
+                throw std::logic_error("argparse::StaticParser: duplicate flag");
+            }
+            mSlots[Slot] = static_cast<uint32_t>(Index + 1);
+        }
+
+        /**
+         * @brief StaticParser::indexOf(const StringView &) const throwing for unknown flags
+         *
+         * @version 1.0.0
+         * @authors Eugene Azimut
+         */
+        size_t checkedIndexOf(const StringView &Flag) const {
+            const size_t Index = indexOf(Flag);
+            if (Index == NOT_FOUND) {
+                throw std::invalid_argument(
+                    std::string("argparse::StaticParser: unknown flag - ") + Flag.toString()
+                );
+            }
+            return Index;
+        }
+
+        /**
+         * @brief Builds error message of StaticParser::parse(int, const char *[], StaticResult<N> &) const
+         *
+         * @version 1.0.0
+         * @authors Eugene Azimut
+         */
+        static std::string error(const char *Reason, const StringView &Flag) {
+            return std::string("argparse::StaticParser::parse(int, const char *[], StaticResult<N> &): ") +
+                Reason + " - " + Flag.toString();
+        }
+
+    //* Variables
+        StaticOption mOptions[N];           ///< Schema
+        uint32_t     mSlots[TABLE_SIZE];    ///< Flag table. 0 - empty slot, otherwise option index + 1
+    };
+
+    template<size_t N>
+    constexpr size_t StaticParser<N>::NOT_FOUND;
+
+    template<size_t N>
+    constexpr size_t StaticParser<N>::TABLE_SIZE;
+
+    /**
+     * @brief Creates StaticParser deducing the number of options
+     * @details Example:
+     * @code {.cpp}
+     *     constexpr auto Parser = makeStaticParser(Options);
+     * @endcode
+     *
+     * @param[in] Options Schema
+     * @return Parser
+     *
+     * @throw std::logic_error in case of invalid schema
+     *
+     * @version 1.0.0
+     * @authors Eugene Azimut
+     */
+    template<size_t N>
+    constexpr StaticParser<N> makeStaticParser(const StaticOption (&Options)[N]) {
+        return StaticParser<N>(Options);
+    }
+}
@@ -0,0 +1,281 @@
+/**
+ * @file StringView.hpp
+ * @brief Declaration of non-owning string view
+ *
+ * @version 1.0.0
+ * @authors Eugene Azimut
+ * @copyright Copyright (c) Eugene Azimut, 2026
+ */
+#pragma once
+#include "api.hpp"
+
+#include <cstddef>
+#include <cstring>
+#include <string>
+
+
+
+namespace argparse {
+    /**
+     * @class StringView
+     * @brief Non-owning read-only view of a character sequence
+     * @details Minimal C++11 replacement of std::string_view.
+     * Refers to memory owned by someone else (usually argv) and never allocates.\n
+     * The viewed sequence isn't required to be null-terminated
+     *
+     * @warning The viewed memory must outlive the view
+     *
+     * @version 1.0.0
+     * @authors Eugene Azimut
+     */
+    class StringView {
+    public:
+        /**
+         * @brief Special value for "not found" and "until the end"
+         *
+         * @version 1.0.0
+         * @authors Eugene Azimut
+         */
+        static constexpr size_t npos = static_cast<size_t>(-1);
+
+    //* Ctors
+        /**
+         * @brief Default constructor
+         * @details Creates an empty view
+         *
+         * @version 1.0.0
+         * @authors Eugene Azimut
+         */
+        constexpr StringView() noexcept:
+        mData(""), mSize(0) {}
+
+        /**
+         * @brief Creates view of null-terminated string
+         * @param[in] Str Null-terminated string. nullptr is treated as an empty string
+         *
+         * @version 1.0.0
+         * @authors Eugene Azimut
+         */
+        constexpr StringView(const char *Str) noexcept:
+        mData(Str ? Str : ""), mSize(Str ? length(Str) : 0) {}
+
+        /**
+         * @brief Creates view of Size characters starting at Str
+         * @param[in] Str Pointer to the first character
+         * @param[in] Size Number of characters
+         *
+         * @version 1.0.0
+         * @authors Eugene Azimut
+         */
+        constexpr StringView(const char *Str, size_t Size) noexcept:
+        mData(Str), mSize(Size) {}
+
+        /**
+         * @brief Creates view of std::string contents
+         * @param[in] Str String to be viewed
+         *
+         * @version 1.0.0
+         * @authors Eugene Azimut
+         */
+        StringView(const std::string &Str) noexcept:
+        mData(Str.data()), mSize(Str.size()) {}
+
+    //* Getters
+        /**
+         * @brief Returns pointer to the first character
+         * @return Pointer to the first character
+         *
+         * @version 1.0.0
+         * @authors Eugene Azimut
+         */
+        constexpr const char *data() const noexcept {
+            return mData;
+        }
+
+        /**
+         * @brief Returns number of characters
+         * @return Number of characters
+         *
+         * @version 1.0.0
+         * @authors Eugene Azimut
+         */
+        constexpr size_t size() const noexcept {
+            return mSize;
+        }
+
+        /**
+         * @brief Returns true if the view is empty
+         * @return Boolean value
+         *
+         * @version 1.0.0
+         * @authors Eugene Azimut
+         */
+        constexpr bool empty() const noexcept {
+            return mSize == 0;
+        }
+
+        /**
+         * @brief Returns character at position Pos without bounds checking
+         * @param[in] Pos Position of character
+         * @return Character
+         *
+         * @version 1.0.0
+         * @authors Eugene Azimut
+         */
+        constexpr char operator[](size_t Pos) const noexcept {
+            return mData[Pos];
+        }
+
+    //* etc
+        /**
+         * @brief Returns a view of the substring [Pos; Pos + Count)
+         * @details Pos and Count are clamped to the view bounds
+         *
+         * @param[in] Pos Position of the first character
+         * @param[in] Count Requested length. Default: until the end
+         * @return View of the substring
+         *
+         * @version 1.0.0
+         * @authors Eugene Azimut
+         */
+        constexpr StringView substr(size_t Pos, size_t Count = npos) const noexcept {
+            return Pos >= mSize ?
+                StringView(mData + mSize, 0) :
+                StringView(mData + Pos, Count < mSize - Pos ? Count : mSize - Pos);
+        }
+
+        /**
+         * @brief Finds the first occurrence of Ch starting at Pos
+         * @param[in] Ch Character to be found
+         * @param[in] Pos Position to start search at
+         * @return Position of Ch or StringView::npos
+         *
+         * @version 1.0.0
+         * @authors Eugene Azimut
+         */
+        size_t find(char Ch, size_t Pos = 0) const noexcept {
+            if (Pos >= mSize) return npos;
+
+            const void *Found = std::memchr(mData + Pos, Ch, mSize - Pos);
+            return Found ? static_cast<const char *>(Found) - mData : npos;
+        }
+
+        /**
+         * @brief Finds the first occurrence of Str starting at Pos
+         * @details Behaves as std::string::find: an empty Str is found at Pos
+         *
+         * @param[in] Str Sequence to be found
+         * @param[in] Pos Position to start search at
+         * @return Position of Str or StringView::npos
+         *
+         * @version 1.0.0
+         * @authors Eugene Azimut
+         */
+        size_t find(const StringView &Str, size_t Pos = 0) const noexcept {
+            if (Str.mSize == 0) return Pos <= mSize ? Pos : npos;
+            if (Str.mSize > mSize) return npos;
+
+            const size_t Last = mSize - Str.mSize;
+            while (Pos <= Last) {
+                Pos = find(Str.mData[0], Pos);
+                if (Pos == npos || Pos > Last) return npos;
+                if (std::memcmp(mData + Pos, Str.mData, Str.mSize) == 0) return Pos;
+                ++Pos;
+            }
+            return npos;
+        }
+
+        /**
+         * @brief Checks if the view begins with Prefix
+         * @param[in] Prefix Expected prefix
+         * @return true if the view begins with Prefix, false if not
+         *
+         * @version 1.0.0
+         * @authors Eugene Azimut
+         */
+        bool startsWith(const StringView &Prefix) const noexcept {
+            return mSize >= Prefix.mSize &&
+                std::memcmp(mData, Prefix.mData, Prefix.mSize) == 0;
+        }
+
+        /**
+         * @brief Lexicographically compares the view with Other
+         * @param[in] Other View to compare with
+         * @return Negative, zero or positive value like std::string::compare
+         *
+         * @version 1.0.0
+         * @authors Eugene Azimut
+         */
+        int compare(const StringView &Other) const noexcept {
+            const size_t Len = mSize < Other.mSize ? mSize : Other.mSize;
+            const int Res = Len ? std::memcmp(mData, Other.mData, Len) : 0;
+            if (Res != 0) return Res;
+            return mSize == Other.mSize ? 0 : (mSize < Other.mSize ? -1 : 1);
+        }
+
+        /**
+         * @brief Copies viewed characters into a new std::string
+         * @return Owning copy
+         *
+         * @throw std::bad_alloc in case of memory allocation failure
+         *
+         * @version 1.0.0
+         * @authors Eugene Azimut
+         */
+        std::string toString() const {
+            return std::string(mData, mSize);
+        }
+
+    private:
+        /**
+         * @brief Length of null-terminated string usable in constant expressions
+         * @param[in] Str Null-terminated string
+         * @return Length of Str
+         *
+         * @version 1.0.0
+         * @authors Eugene Azimut
+         */
+        static constexpr size_t length(const char *Str) noexcept {
+        #if defined(__GNUC__) || defined(__clang__)
+            return __builtin_strlen(Str);
+        #else
+            return *Str ? 1 + length(Str + 1) : 0;
+        #endif
+        }
+
+    //* Variables
+        const char *mData;      ///< Pointer to the first character
+        size_t      mSize;      ///< Number of characters
+    };
+
+    /**
+     * @brief Checks if two views contain equal sequences
+     *
+     * @version 1.0.0
+     * @authors Eugene Azimut
+     */
+    inline bool operator==(const StringView &Left, const StringView &Right) noexcept {
+        return Left.size() == Right.size() &&
+            (Left.size() == 0 || std::memcmp(Left.data(), Right.data(), Left.size()) == 0);
+    }
+
+    /**
+     * @brief Checks if two views contain different sequences
+     *
+     * @version 1.0.0
+     * @authors Eugene Azimut
+     */
+    inline bool operator!=(const StringView &Left, const StringView &Right) noexcept {
+        return !(Left == Right);
+    }
+
+    /**
+     * @brief Lexicographical "less" for views
+     *
+     * @version 1.0.0
+     * @authors Eugene Azimut
+     */
+    inline bool operator<(const StringView &Left, const StringView &Right) noexcept {
+        return Left.compare(Right) < 0;
+    }
+}
@@ -12,3 +12,12 @@
 #include "api.hpp"
 #include "ArgumentParser.hpp"
 #include "args/BooleanArg.hpp"
+#include "args/NumericArg.hpp"
+#include "args/SizeArg.hpp"
+#include "args/DurationArg.hpp"
+#include "args/ChoiceArg.hpp"
+#include "args/ListArg.hpp"
+
+#if __cplusplus >= 201402L
+    #include "StaticParser.hpp"
+#endif
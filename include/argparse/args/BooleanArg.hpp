@@ -287,6 +287,49 @@ namespace argparse {
              */
             virtual void setDefaultValue(bool Value);
 
+        //* Parsing callbacks
+            /**
+             * @brief Places DefaultValue in output variable
+             *
+             * @version 1.0.0
+             * @authors Eugene Azimut
+             */
+            virtual void applyDefault() override;
+
+            /**
+             * @brief Places StoreValue in output variable
+             *
+             * @version 1.0.0
+             * @authors Eugene Azimut
+             */
+            virtual void applyFlag() override;
+
+            /**
+             * @brief Checks that Value is a boolean literal
+             * @param[in] Value Literal, see BooleanArg::applyValue(const StringView &)
+             * @return ErrorCode::SUCCESS or ErrorCode::INVALID_VALUE
+             *
+             * @version 1.0.0
+             * @authors Eugene Azimut
+             */
+            virtual ErrorCode validateValue(const StringView &Value) const noexcept override;
+
+            /**
+             * @brief Converts Value and places it in output variable
+             * @details Values come from "--flag=value", the environment and config file alike,
+             * so all of them are accepted only if NArgs allows a value
+             *
+             * @param[in] Value One of (case-insensitive):
+             *   * "true", "yes", "on", "1";
+             *   * "false", "no", "off", "0"
+             *
+             * @throw std::runtime_error in case of invalid boolean value
+             *
+             * @version 1.0.0
+             * @authors Eugene Azimut
+             */
+            virtual void applyValue(const StringView &Value) override;
+
         private:
             /**
              * @brief Copies current class members
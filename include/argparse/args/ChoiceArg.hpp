@@ -0,0 +1,432 @@
+/**
+ * @file ChoiceArg.hpp
+ * @brief Declaration of enumerated CLI argument
+ *
+ * @version 1.0.0
+ * @authors Eugene Azimut
+ * @copyright Copyright (c) Eugene Azimut, 2026
+ */
+#pragma once
+#include "../api.hpp"
+#include "IOptionalArgument.hpp"
+
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+
+
+namespace argparse {
+    namespace args {
+        /**
+         * @class ChoiceArg
+         * @brief Contains definition and parameters of enumerated CLI argument
+         * @details This argument type is desired to store a command-line argument
+         * which accepts one of the fixed set of names, each mapped to an integer or enum value.\n
+         * A minimal perfect hash of the names is built when the argument is constructed
+         * (hash and displace: every bucket of names gets a seed which sends its names to
+         * free slots), so resolving a value costs one hash and one string comparison
+         * regardless of number of choices. Invalid values are reported with the list of
+         * allowed names.\n
+         * Example:
+         * @code {.cpp}
+         *     enum class Codec {NONE, LZ4, ZSTD};
+         *
+         *     Codec Compression = Codec::NONE;
+         *     Parser.addArgument(ChoiceArg(
+         *         Compression, {"--compression"},
+         *         {{"none", Codec::NONE}, {"lz4", Codec::LZ4}, {"zstd", Codec::ZSTD}},
+         *         "Compression codec"
+         *     ));
+         * @endcode
+         * Command line:
+         * @code {.sh}
+         *     ./my_prog --compression=zstd
+         * @endcode
+         * Result:
+         * @code
+         *     Compression = Codec::ZSTD
+         * @endcode
+         *
+         * @version 1.0.0
+         * @authors Eugene Azimut
+         */
+        ARGPARSE_API class ChoiceArg: public IOptionalArgument {
+        public:
+            /**
+             * @struct Choice
+             * @brief Accepted name and its value
+             *
+             * @version 1.0.0
+             * @authors Eugene Azimut
+             */
+            struct Choice {
+                std::string Name;   ///< Accepted name
+                int64_t     Value;  ///< Value placed in output variable
+            };
+
+            /**
+             * @brief Value returned by ChoiceArg::find(const StringView &) const for unknown names
+             *
+             * @version 1.0.0
+             * @authors Eugene Azimut
+             */
+            static constexpr uint32_t NOT_FOUND = UINT32_MAX;
+
+        //* Ctors and dtor
+            /**
+             * @brief Default constructor
+             * @details Creates new instance of enumerated CLI argument
+             *
+             * @tparam T Integer or enumeration type
+             *
+             * @param[out] Output Reference to a variable in which value will be placed
+             * @param[in] FlagsList Either a name or a list of option strings
+             * @param[in] Choices Accepted names and their values
+             * @param[in] Help A brief description of what the argument does
+             * @param[in] NArgs The number of command-line arguments that should be consumed.\n
+             * Available values:
+             *   * 1;
+             *   * NARGS::ZERO_OR_ONE
+             * @param[in] IsRequired Whether or not the command-line option may be omitted (optionals only)
+             * @param[in] IsDeprecated Whether or not use of the argument is deprecated
+             *
+             * @param[in] StoreValue Value if flag recognized and value wasn't passed
+             * @param[in] DefaultValue Default value if flag wasn't recognized
+             *
+             * @throw std::bad_alloc in case of memory allocation failure
+             * @throw std::invalid_argument in case of invalid NArgs value, empty Choices or duplicate names
+             *
+             * @version 1.0.0
+             * @authors Eugene Azimut
+             */
+            template<typename T>
+            ChoiceArg(
+                T &Output,
+
+                const Flags &FlagsList,
+                const std::vector<std::pair<std::string, T>> &Choices,
+                const std::string &Help = "",
+                uint32_t NArgs = 1,
+                bool IsRequired   = false,
+                bool IsDeprecated = false,
+
+                T StoreValue   = T(),
+                T DefaultValue = T()
+            ):
+            ChoiceArg(
+                &Output, &store<T>, Flags(FlagsList), toChoices(Choices), Help, NArgs, IsRequired, IsDeprecated,
+                static_cast<int64_t>(StoreValue), static_cast<int64_t>(DefaultValue)
+            ) {}
+
+            /**
+             * @brief Default constructor
+             * @details Creates new instance of enumerated CLI argument.\n
+             * This constructor is appliable to initializers:
+             * @code {.cpp}
+             *     ChoiceArg(
+             *         MyVar,
+             *         {"-c", "--compression"},
+             *         {{"none", 0}, {"lz4", 1}, {"zstd", 2}},
+             *         "Help message",
+             *         1,
+             *         false, false,
+             *         0, 0
+             *     );
+             * @endcode
+             *
+             * @tparam T Integer or enumeration type
+             *
+             * @param[out] Output Reference to a variable in which value will be placed
+             * @param[in] FlagsList Either a name or a list of option strings
+             * @param[in] Choices Accepted names and their values
+             * @param[in] Help A brief description of what the argument does
+             * @param[in] NArgs The number of command-line arguments that should be consumed.\n
+             * Available values:
+             *   * 1;
+             *   * NARGS::ZERO_OR_ONE
+             * @param[in] IsRequired Whether or not the command-line option may be omitted (optionals only)
+             * @param[in] IsDeprecated Whether or not use of the argument is deprecated
+             *
+             * @param[in] StoreValue Value if flag recognized and value wasn't passed
+             * @param[in] DefaultValue Default value if flag wasn't recognized
+             *
+             * @throw std::bad_alloc in case of memory allocation failure
+             * @throw std::invalid_argument in case of invalid NArgs value, empty Choices or duplicate names
+             *
+             * @version 1.0.0
+             * @authors Eugene Azimut
+             */
+            template<typename T>
+            ChoiceArg(
+                T &Output,
+
+                Flags &&FlagsList,
+                const std::vector<std::pair<std::string, T>> &Choices,
+                const std::string &Help = "",
+                uint32_t NArgs = 1,
+                bool IsRequired   = false,
+                bool IsDeprecated = false,
+
+                T StoreValue   = T(),
+                T DefaultValue = T()
+            ):
+            ChoiceArg(
+                &Output, &store<T>, std::move(FlagsList), toChoices(Choices), Help, NArgs, IsRequired, IsDeprecated,
+                static_cast<int64_t>(StoreValue), static_cast<int64_t>(DefaultValue)
+            ) {}
+
+            /**
+             * @brief Copy constructor
+             * @details Creates new instance of enumerated CLI argument as a copy of Other
+             *
+             * @param[in] Other Instance to copy
+             *
+             * @throw std::bad_alloc in case of memory allocation failure
+             *
+             * @version 1.0.0
+             * @authors Eugene Azimut
+             */
+            ChoiceArg(const ChoiceArg &Other);
+
+            /**
+             * @brief Move constructor
+             * @details Creates new instance of enumerated CLI argument moving Other
+             *
+             * @param[in] Other Instance to move
+             *
+             * @version 1.0.0
+             * @authors Eugene Azimut
+             */
+            ChoiceArg(ChoiceArg &&Other) noexcept;
+
+            /**
+             * @brief Destroies instance of enumerated CLI argument
+             *
+             * @version 1.0.0
+             * @authors Eugene Azimut
+             */
+            virtual ~ChoiceArg() noexcept;
+
+        //* Getters and setters
+            /**
+             * @brief Set the number of command-line arguments that should be consumed
+             * @param[in] NArgs The number of command-line arguments that should be consumed.\n
+             * Available values:
+             *   * 1;
+             *   * NARGS::ZERO_OR_ONE
+             *
+             * @throw std::invalid_argument in case of invalid NArgs value
+             *
+             * @version 1.0.0
+             * @authors Eugene Azimut
+             */
+            virtual void setNArgs(uint32_t NArgs) override;
+
+            /**
+             * @brief Returns accepted names and their values
+             * @return Choices in order of declaration
+             *
+             * @version 1.0.0
+             * @authors Eugene Azimut
+             */
+            virtual const std::vector<Choice> &getChoices() const;
+
+            /**
+             * @brief Returns value if flag recognized and value wasn't passed
+             * @return Value if flag recognized and value wasn't passed
+             *
+             * @version 1.0.0
+             * @authors Eugene Azimut
+             */
+            virtual int64_t getStoreValue() const;
+
+            /**
+             * @brief Sets value if flag recognized and value wasn't passed
+             * @param[in] Value Value if flag recognized and value wasn't passed
+             *
+             * @version 1.0.0
+             * @authors Eugene Azimut
+             */
+            virtual void setStoreValue(int64_t Value);
+
+            /**
+             * @brief Returns default value if flag wasn't recognized
+             * @return Default value if flag wasn't recognized
+             *
+             * @version 1.0.0
+             * @authors Eugene Azimut
+             */
+            virtual int64_t getDefaultValue() const;
+
+            /**
+             * @brief Sets default value if flag wasn't recognized
+             * @param[in] Value Default value if flag wasn't recognized
+             *
+             * @version 1.0.0
+             * @authors Eugene Azimut
+             */
+            virtual void setDefaultValue(int64_t Value);
+
+        //* etc
+            /**
+             * @brief Finds choice by Name
+             * @details One hash of Name and at most one string comparison. Doesn't allocate
+             *
+             * @param[in] Name Name to be found
+             * @return Index of choice in ChoiceArg::getChoices() const or ChoiceArg::NOT_FOUND
+             *
+             * @version 1.0.0
+             * @authors Eugene Azimut
+             */
+            uint32_t find(const StringView &Name) const noexcept;
+
+        //* Parsing callbacks
+            /**
+             * @brief Places DefaultValue in output variable
+             *
+             * @version 1.0.0
+             * @authors Eugene Azimut
+             */
+            virtual void applyDefault() override;
+
+            /**
+             * @brief Places StoreValue in output variable
+             *
+             * @version 1.0.0
+             * @authors Eugene Azimut
+             */
+            virtual void applyFlag() override;
+
+            /**
+             * @brief Checks that Value is an accepted name
+             * @param[in] Value Name to be checked
+             * @return ErrorCode::SUCCESS or ErrorCode::INVALID_VALUE
+             *
+             * @version 1.0.0
+             * @authors Eugene Azimut
+             */
+            virtual ErrorCode validateValue(const StringView &Value) const noexcept override;
+
+            /**
+             * @brief Places value of choice named Value in output variable
+             * @param[in] Value One of accepted names
+             *
+             * @throw std::runtime_error in case Value isn't an accepted name
+             *
+             * @version 1.0.0
+             * @authors Eugene Azimut
+             */
+            virtual void applyValue(const StringView &Value) override;
+
+        private:
+            /**
+             * @brief Function which places Value in output variable of specific type
+             */
+            using Writer = void (*)(void *Output, int64_t Value);
+
+            /**
+             * @brief Creates new instance of enumerated CLI argument with type-erased output
+             * @details Builds the perfect hash of Choices
+             *
+             * @throw std::bad_alloc in case of memory allocation failure
+             * @throw std::invalid_argument in case of invalid NArgs value, empty Choices or duplicate names
+             *
+             * @version 1.0.0
+             * @authors Eugene Azimut
+             */
+            ChoiceArg(
+                void *Output, Writer Store,
+                Flags &&FlagsList,
+                std::vector<Choice> &&Choices,
+                const std::string &Help,
+                uint32_t NArgs,
+                bool IsRequired, bool IsDeprecated,
+                int64_t StoreValue, int64_t DefaultValue
+            );
+
+            /**
+             * @brief Places Value in output variable of type T
+             *
+             * @version 1.0.0
+             * @authors Eugene Azimut
+             */
+            template<typename T>
+            static void store(void *Output, int64_t Value) {
+                static_assert(
+                    std::is_integral<T>::value || std::is_enum<T>::value,
+                    "T must be an integer or enumeration type"
+                );
+                *static_cast<T *>(Output) = static_cast<T>(Value);
+            }
+
+            /**
+             * @brief Converts pairs of names and values into choices
+             *
+             * @throw std::bad_alloc in case of memory allocation failure
+             *
+             * @version 1.0.0
+             * @authors Eugene Azimut
+             */
+            template<typename T>
+            static std::vector<Choice> toChoices(const std::vector<std::pair<std::string, T>> &Choices) {
+                std::vector<Choice> Result;
+                Result.reserve(Choices.size());
+                for (const std::pair<std::string, T> &Item: Choices) {
+                    Result.push_back(Choice{Item.first, static_cast<int64_t>(Item.second)});
+                }
+                return Result;
+            }
+
+            /**
+             * @brief Builds perfect hash of choices
+             *
+             * @throw std::bad_alloc in case of memory allocation failure
+             * @throw std::invalid_argument in case of empty or duplicate names
+             *
+             * @version 1.0.0
+             * @authors Eugene Azimut
+             */
+            void build();
+
+            /**
+             * @brief Copies current class members
+             * @details The method copies members of only the given class,
+             * even if it is an inheritor, and lets avoid repeating code
+             * in the copy constructor and copy assignment operator
+             *
+             * @param[in] Other Instance to copy
+             *
+             * @version 1.0.0
+             * @authors Eugene Azimut
+             */
+            void selfCopy(const ChoiceArg &Other);
+
+            /**
+             * @brief Moves current class members
+             * @details The method moves members of only the given class,
+             * even if it is an inheritor, and lets avoid repeating code
+             * in the move constructor and move assignment operator
+             *
+             * @param[in] Other Instance to move
+             *
+             * @version 1.0.0
+             * @authors Eugene Azimut
+             */
+            void selfMove(ChoiceArg &&Other) noexcept;
+
+        //* Variables
+            void                 *mOutput;          ///< Pointer to a variable in which value will be placed
+            Writer                mStore;           ///< Places value in output variable
+            int64_t               mStoreValue;      ///< Value if flag recognized and value wasn't passed
+            int64_t               mDefaultValue;    ///< Default value if flag wasn't recognized
+            std::vector<Choice>   mChoices;         ///< Accepted names and their values
+            std::vector<uint32_t> mSeeds;           ///< Displacement seed of every bucket
+            std::vector<uint32_t> mSlots;           ///< Choice index of every slot or NOT_FOUND. Size is a power of two
+            uint64_t              mSalt;            ///< Seed of names hash
+        };
+    }
+}
@@ -0,0 +1,304 @@
+/**
+ * @file DurationArg.hpp
+ * @brief Declaration of duration CLI argument
+ *
+ * @version 1.0.0
+ * @authors Eugene Azimut
+ * @copyright Copyright (c) Eugene Azimut, 2026
+ */
+#pragma once
+#include "../api.hpp"
+#include "IOptionalArgument.hpp"
+
+#include <cstdint>
+
+
+
+namespace argparse {
+    namespace args {
+        /**
+         * @class DurationArg
+         * @brief Contains definition and parameters of duration CLI argument
+         * @details This argument type is desired to store a command-line argument
+         * of a duration in nanoseconds. Value is a sequence of decimal numbers
+         * with optional fraction, each followed by a unit, e.g. "250ms", "1.5s", "2h30m".\n
+         * Units are case-sensitive:
+         *   * "ns" - nanoseconds;
+         *   * "us" (or UTF-8 "µs") - microseconds;
+         *   * "ms" - milliseconds;
+         *   * "s"  - seconds;
+         *   * "m"  - minutes;
+         *   * "h"  - hours;
+         *   * "d"  - days
+         *
+         * The unit may be omitted only for "0". The result is exact:
+         * fractional nanoseconds are truncated. Durations exceeding
+         * 2^64 - 1 nanoseconds (about 584 years) are rejected.\n
+         * Example:
+         * @code {.cpp}
+         *     uint64_t Timeout = 0;
+         *     Parser.addArgument(DurationArg(Timeout, {"-t", "--timeout"}, "Request timeout"));
+         * @endcode
+         * Command line:
+         * @code {.sh}
+         *     ./my_prog --timeout 1m30s
+         * @endcode
+         * Result:
+         * @code
+         *     Timeout = 90000000000
+         * @endcode
+         *
+         * @version 1.0.0
+         * @authors Eugene Azimut
+         */
+        ARGPARSE_API class DurationArg: public IOptionalArgument {
+        public:
+        //* Ctors and dtor
+            /**
+             * @brief Default constructor
+             * @details Creates new instance of duration CLI argument
+             *
+             * @param[out] Output Reference to a variable in which value will be placed
+             * @param[in] FlagsList Either a name or a list of option strings
+             * @param[in] Help A brief description of what the argument does
+             * @param[in] NArgs The number of command-line arguments that should be consumed.\n
+             * Available values:
+             *   * 1;
+             *   * NARGS::ZERO_OR_ONE
+             * @param[in] IsRequired Whether or not the command-line option may be omitted (optionals only)
+             * @param[in] IsDeprecated Whether or not use of the argument is deprecated
+             *
+             * @param[in] StoreValue Value if flag recognized and value wasn't passed
+             * @param[in] DefaultValue Default value if flag wasn't recognized
+             *
+             * @throw std::bad_alloc in case of memory allocation failure
+             * @throw std::invalid_argument in case of invalid NArgs value
+             *
+             * @version 1.0.0
+             * @authors Eugene Azimut
+             */
+            DurationArg(
+                uint64_t &Output,
+
+                const Flags &FlagsList,
+                const std::string &Help = "",
+                uint32_t NArgs = 1,
+                bool IsRequired   = false,
+                bool IsDeprecated = false,
+
+                uint64_t StoreValue   = 0,
+                uint64_t DefaultValue = 0
+            );
+
+            /**
+             * @brief Default constructor
+             * @details Creates new instance of duration CLI argument.\n
+             * This constructor is appliable to initializers:
+             * @code {.cpp}
+             *     DurationArg(
+             *         MyVar,
+             *         {"-t", "--timeout"},
+             *         "Help message",
+             *         1,
+             *         false, false,
+             *         0, 0
+             *     );
+             * @endcode
+             *
+             * @param[out] Output Reference to a variable in which value will be placed
+             * @param[in] FlagsList Either a name or a list of option strings
+             * @param[in] Help A brief description of what the argument does
+             * @param[in] NArgs The number of command-line arguments that should be consumed.\n
+             * Available values:
+             *   * 1;
+             *   * NARGS::ZERO_OR_ONE
+             * @param[in] IsRequired Whether or not the command-line option may be omitted (optionals only)
+             * @param[in] IsDeprecated Whether or not use of the argument is deprecated
+             *
+             * @param[in] StoreValue Value if flag recognized and value wasn't passed
+             * @param[in] DefaultValue Default value if flag wasn't recognized
+             *
+             * @throw std::bad_alloc in case of memory allocation failure
+             * @throw std::invalid_argument in case of invalid NArgs value
+             *
+             * @version 1.0.0
+             * @authors Eugene Azimut
+             */
+            DurationArg(
+                uint64_t &Output,
+
+                Flags &&FlagsList,
+                const std::string &Help = "",
+                uint32_t NArgs = 1,
+                bool IsRequired   = false,
+                bool IsDeprecated = false,
+
+                uint64_t StoreValue   = 0,
+                uint64_t DefaultValue = 0
+            );
+
+            /**
+             * @brief Copy constructor
+             * @details Creates new instance of duration CLI argument as a copy of Other
+             *
+             * @param[in] Other Instance to copy
+             *
+             * @throw std::bad_alloc in case of memory allocation failure
+             *
+             * @version 1.0.0
+             * @authors Eugene Azimut
+             */
+            DurationArg(const DurationArg &Other);
+
+            /**
+             * @brief Move constructor
+             * @details Creates new instance of duration CLI argument moving Other
+             *
+             * @param[in] Other Instance to move
+             *
+             * @version 1.0.0
+             * @authors Eugene Azimut
+             */
+            DurationArg(DurationArg &&Other) noexcept;
+
+            /**
+             * @brief Destroies instance of duration CLI argument
+             *
+             * @version 1.0.0
+             * @authors Eugene Azimut
+             */
+            virtual ~DurationArg() noexcept;
+
+        //* Getters and setters
+            /**
+             * @brief Set the number of command-line arguments that should be consumed
+             * @param[in] NArgs The number of command-line arguments that should be consumed.\n
+             * Available values:
+             *   * 1;
+             *   * NARGS::ZERO_OR_ONE
+             *
+             * @throw std::invalid_argument in case of invalid NArgs value
+             *
+             * @version 1.0.0
+             * @authors Eugene Azimut
+             */
+            virtual void setNArgs(uint32_t NArgs) override;
+
+            /**
+             * @brief Returns the pointer to output variable
+             * @return Pointer to output variable
+             *
+             * @version 1.0.0
+             * @authors Eugene Azimut
+             */
+            virtual uint64_t *getOutput() const;
+
+            /**
+             * @brief Returns value if flag recognized and value wasn't passed
+             * @return Value if flag recognized and value wasn't passed
+             *
+             * @version 1.0.0
+             * @authors Eugene Azimut
+             */
+            virtual uint64_t getStoreValue() const;
+
+            /**
+             * @brief Sets value if flag recognized and value wasn't passed
+             * @param[in] Value Value if flag recognized and value wasn't passed
+             *
+             * @version 1.0.0
+             * @authors Eugene Azimut
+             */
+            virtual void setStoreValue(uint64_t Value);
+
+            /**
+             * @brief Returns default value if flag wasn't recognized
+             * @return Default value if flag wasn't recognized
+             *
+             * @version 1.0.0
+             * @authors Eugene Azimut
+             */
+            virtual uint64_t getDefaultValue() const;
+
+            /**
+             * @brief Sets default value if flag wasn't recognized
+             * @param[in] Value Default value if flag wasn't recognized
+             *
+             * @version 1.0.0
+             * @authors Eugene Azimut
+             */
+            virtual void setDefaultValue(uint64_t Value);
+
+        //* Parsing callbacks
+            /**
+             * @brief Places DefaultValue in output variable
+             *
+             * @version 1.0.0
+             * @authors Eugene Azimut
+             */
+            virtual void applyDefault() override;
+
+            /**
+             * @brief Places StoreValue in output variable
+             *
+             * @version 1.0.0
+             * @authors Eugene Azimut
+             */
+            virtual void applyFlag() override;
+
+            /**
+             * @brief Checks that Value is a duration fitting 64 bits
+             * @param[in] Value Duration, see DurationArg for accepted formats
+             * @return ErrorCode::SUCCESS, ErrorCode::INVALID_VALUE for malformed durations and unknown units,
+             * ErrorCode::VALUE_OUT_OF_RANGE for durations which don't fit 64 bits
+             *
+             * @version 1.0.0
+             * @authors Eugene Azimut
+             */
+            virtual ErrorCode validateValue(const StringView &Value) const noexcept override;
+
+            /**
+             * @brief Converts Value and places it in output variable
+             * @param[in] Value Duration, see DurationArg for accepted formats
+             *
+             * @throw std::runtime_error in case of invalid duration or duration which doesn't fit 64 bits
+             *
+             * @version 1.0.0
+             * @authors Eugene Azimut
+             */
+            virtual void applyValue(const StringView &Value) override;
+
+        private:
+            /**
+             * @brief Copies current class members
+             * @details The method copies members of only the given class,
+             * even if it is an inheritor, and lets avoid repeating code
+             * in the copy constructor and copy assignment operator
+             *
+             * @param[in] Other Instance to copy
+             *
+             * @version 1.0.0
+             * @authors Eugene Azimut
+             */
+            void selfCopy(const DurationArg &Other);
+
+            /**
+             * @brief Moves current class members
+             * @details The method moves members of only the given class,
+             * even if it is an inheritor, and lets avoid repeating code
+             * in the move constructor and move assignment operator
+             *
+             * @param[in] Other Instance to move
+             *
+             * @version 1.0.0
+             * @authors Eugene Azimut
+             */
+            void selfMove(DurationArg &&Other) noexcept;
+
+        //* Variables
+            uint64_t *mOutput;          ///< Pointer to a variable in which value will be placed
+            uint64_t  mStoreValue;      ///< Value if flag recognized and value wasn't passed
+            uint64_t  mDefaultValue;    ///< Default value if flag wasn't recognized
+        };
+    }
+}
@@ -8,9 +8,12 @@
  */
 #pragma once
 #include "../api.hpp"
+#include "../ArgparseError.hpp"
+#include "../StringView.hpp"
 #include "NARGS.hpp"
 
 #include <string>
+#include <vector>
 
 
 
@@ -131,6 +134,8 @@ namespace argparse {
              * @param[in] NArgs The number of command-line arguments that should be consumed.
              * See args::NARGS for special values
              *
+             * @throw std::invalid_argument in case NArgs is NARGS::NO_MORE and environment variable is set
+             *
              * @version 1.0.0
              * @authors Eugene Azimut
              */
@@ -172,6 +177,176 @@ namespace argparse {
              */
             virtual void setDeprecated(bool IsDeprecated = true);
 
+            /**
+             * @brief Returns name of environment variable used when the argument is omitted
+             * @return Name of environment variable. Empty if there is no fallback
+             *
+             * @version 1.0.0
+             * @authors Eugene Azimut
+             */
+            virtual const std::string &getEnvVar() const;
+
+            /**
+             * @brief Sets name of environment variable used when the argument is omitted
+             * @details If the argument doesn't occur on the command line and the variable is set,
+             * its value is applied as if it were attached to the argument: "--threads" with
+             * "APP_THREADS=8" is the same as "--threads=8".
+             * Hence only arguments which accept values may have the variable:
+             * a BooleanArg read from the environment needs NARGS::ZERO_OR_ONE
+             *
+             * @param[in] Name Name of environment variable, e.g. "APP_THREADS". Empty disables fallback
+             *
+             * @throw std::invalid_argument in case Name isn't empty and the argument accepts no values
+             * @throw std::bad_alloc in case of memory allocation failure
+             *
+             * @version 1.0.0
+             * @authors Eugene Azimut
+             */
+            virtual void setEnvVar(const std::string &Name);
+
+            /**
+             * @brief Returns flags of arguments which must be given together with the argument
+             * @return Flags in order of addition
+             *
+             * @version 1.0.0
+             * @authors Eugene Azimut
+             */
+            virtual const std::vector<std::string> &getRequires() const;
+
+            /**
+             * @brief Adds argument which must be given together with the argument
+             * @details E.g. "--tls-cert" requires "--tls-key": giving "--tls-cert" alone is an error.
+             * Rules are checked by the parser after implications are applied,
+             * see ArgumentParser::getViolations(const ParseResult &) const
+             *
+             * @param[in] Flag Any flag of the required argument
+             *
+             * @throw std::bad_alloc in case of memory allocation failure
+             *
+             * @version 1.0.0
+             * @authors Eugene Azimut
+             */
+            virtual void addRequires(const std::string &Flag);
+
+            /**
+             * @brief Returns flags of arguments implied by the argument
+             * @return Flags in order of addition
+             *
+             * @version 1.0.0
+             * @authors Eugene Azimut
+             */
+            virtual const std::vector<std::string> &getImplies() const;
+
+            /**
+             * @brief Adds argument implied by the argument
+             * @details E.g. "--dry-run" implies "--no-commit": giving "--dry-run" is the same
+             * as giving "--dry-run --no-commit". Implications are transitive
+             * and the implied argument receives IArgument::applyFlag() if it wasn't given
+             *
+             * @param[in] Flag Any flag of the implied argument
+             *
+             * @throw std::bad_alloc in case of memory allocation failure
+             *
+             * @version 1.0.0
+             * @authors Eugene Azimut
+             */
+            virtual void addImplies(const std::string &Flag);
+
+            /**
+             * @brief Returns number of changes of the argument parameters
+             * @details Every setter above increments it, so a parser holding the argument
+             * tells that its cached help and compiled constraints are stale
+             * even if the argument was changed through a reference
+             *
+             * @return Revision of parameters
+             *
+             * @version 1.0.0
+             * @authors Eugene Azimut
+             */
+            uint64_t getRevision() const;
+
+        //* Parsing callbacks
+            /**
+             * @brief Applies default value
+             * @details Invoked by ArgumentParser before parsing.\n
+             * Default implementation does nothing
+             *
+             * @version 1.0.0
+             * @authors Eugene Azimut
+             */
+            virtual void applyDefault();
+
+            /**
+             * @brief Announces number of values to be applied
+             * @details Invoked by ArgumentParser after IArgument::applyDefault()
+             * with total number of values consumed by the argument in all its occurrences,
+             * so containers can be reserved once.\n
+             * Default implementation does nothing
+             *
+             * @param[in] Count Number of upcoming IArgument::applyValue(const StringView &) calls
+             *
+             * @version 1.0.0
+             * @authors Eugene Azimut
+             */
+            virtual void reserveValues(uint32_t Count);
+
+            /**
+             * @brief Applies argument presence
+             * @details Invoked by ArgumentParser each time the argument is recognized,
+             * before its values are applied.\n
+             * Default implementation does nothing
+             *
+             * @throw std::runtime_error in case argument cannot be applied
+             *
+             * @version 1.0.0
+             * @authors Eugene Azimut
+             */
+            virtual void applyFlag();
+
+            /**
+             * @brief Checks one value without applying it
+             * @details Invoked by ArgumentParser when a value is bound to the argument
+             * (on the command line, in a response file, the environment or the config file),
+             * so every parsing call reports bad values with their position
+             * instead of throwing from IArgument::applyValue(const StringView &).
+             * Must neither allocate nor throw.\n
+             * Default implementation accepts every value
+             *
+             * @param[in] Value View of consumed value
+             * @return ErrorCode::SUCCESS, ErrorCode::INVALID_VALUE or ErrorCode::VALUE_OUT_OF_RANGE
+             *
+             * @version 1.0.0
+             * @authors Eugene Azimut
+             */
+            virtual ErrorCode validateValue(const StringView &Value) const noexcept;
+
+            /**
+             * @brief Applies one consumed value
+             * @details Invoked by ArgumentParser for each value consumed by the argument
+             * according to its NArgs. Values reaching it were accepted by
+             * IArgument::validateValue(const StringView &) const.\n
+             * Default implementation does nothing
+             *
+             * @param[in] Value View of consumed value. Valid only during the call
+             *
+             * @throw std::runtime_error in case of invalid value
+             *
+             * @version 1.0.0
+             * @authors Eugene Azimut
+             */
+            virtual void applyValue(const StringView &Value);
+
+        protected:
+            /**
+             * @brief Marks parameters as changed
+             * @details Setters of inheritors call it for parameters shown in help
+             * or used by constraints, see IArgument::getRevision() const
+             *
+             * @version 1.0.0
+             * @authors Eugene Azimut
+             */
+            void touch();
+
         private:
             /**
              * @brief Copies current class members
@@ -206,6 +381,10 @@ namespace argparse {
             uint32_t    mNArgs;             ///< The number of command-line arguments that should be consumed
             bool        mIsRequired;        ///< Whether or not the command-line option may be omitted
             bool        mIsDeprecated;      ///< Whether or not use of the argument is deprecated
+            std::string mEnvVar;            ///< Name of fallback environment variable
+            std::vector<std::string> mRequires;     ///< Flags of required arguments
+            std::vector<std::string> mImplies;      ///< Flags of implied arguments
+            uint64_t    mRevision;          ///< Number of changes of parameters
         };
     }
 }
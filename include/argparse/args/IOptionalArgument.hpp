@@ -171,6 +171,27 @@ namespace argparse {
              */
             virtual void setFlags(Flags &&FlagsList);
 
+            /**
+             * @brief Get name of values in help
+             * @return Name of values. Empty if the name is derived from the longest flag,
+             * e.g. "THREADS" for "--threads"
+             *
+             * @version 1.0.0
+             * @authors Eugene Azimut
+             */
+            virtual const std::string &getMetavar() const;
+
+            /**
+             * @brief Set name of values in help
+             * @param[in] Metavar Name of values, e.g. "N" or "{fast,slow}". Empty to derive it from flags
+             *
+             * @throw std::bad_alloc in case of memory allocation failure
+             *
+             * @version 1.0.0
+             * @authors Eugene Azimut
+             */
+            virtual void setMetavar(const std::string &Metavar);
+
         private:
             /**
              * @brief Copies current class members
@@ -202,6 +223,7 @@ namespace argparse {
 
         //* Variables
             Flags mFlags;             ///< A list of option strings
+            std::string mMetavar;     ///< Name of values in help
         };
     }
 }
@@ -0,0 +1,298 @@
+/**
+ * @file ListArg.hpp
+ * @brief Declaration of list CLI argument
+ *
+ * @version 1.0.0
+ * @authors Eugene Azimut
+ * @copyright Copyright (c) Eugene Azimut, 2026
+ */
+#pragma once
+#include "../api.hpp"
+#include "IOptionalArgument.hpp"
+
+#include <cstdint>
+#include <string>
+#include <vector>
+
+
+
+namespace argparse {
+    namespace args {
+        /**
+         * @class ListArg
+         * @brief Contains definition and parameters of list CLI argument
+         * @details This argument type is desired to collect values of repeated options
+         * ("-I a -I b") and delimited values ("--hosts=a,b,c") into a vector of strings.\n
+         * Values of all occurrences are appended in order of appearance. Default value
+         * is placed when the option is absent and is dropped by the first occurrence.
+         * Capacity of the output vector is reserved from the number of values counted by
+         * the parser and from the number of delimiters, which are counted by a vector scan,
+         * so collecting N items costs O(N) regardless of how they are passed.\n
+         * Example:
+         * @code {.cpp}
+         *     std::vector<std::string> Hosts;
+         *     Parser.addArgument(ListArg(Hosts, {"-H", "--hosts"}, "Target hosts", NARGS::ONE_AND_MORE))
+         *         .setDelimiter(',');
+         * @endcode
+         * Command line:
+         * @code {.sh}
+         *     ./my_prog --hosts=a,b -H c d
+         * @endcode
+         * Result:
+         * @code
+         *     Hosts = {"a", "b", "c", "d"}
+         * @endcode
+         *
+         * @version 1.0.0
+         * @authors Eugene Azimut
+         */
+        ARGPARSE_API class ListArg: public IOptionalArgument {
+        public:
+        //* Ctors and dtor
+            /**
+             * @brief Default constructor
+             * @details Creates new instance of list CLI argument
+             *
+             * @param[out] Output Reference to a variable in which value will be placed
+             * @param[in] FlagsList Either a name or a list of option strings
+             * @param[in] Help A brief description of what the argument does
+             * @param[in] NArgs The number of command-line arguments that should be consumed.\n
+             * Any value except NARGS::NO_MORE
+             * @param[in] IsRequired Whether or not the command-line option may be omitted (optionals only)
+             * @param[in] IsDeprecated Whether or not use of the argument is deprecated
+             *
+             * @param[in] Delimiter Character which splits values into items. '\\0' disables splitting
+             * @param[in] DefaultValue Default items if flag wasn't recognized
+             *
+             * @throw std::bad_alloc in case of memory allocation failure
+             * @throw std::invalid_argument in case of invalid NArgs value
+             *
+             * @version 1.0.0
+             * @authors Eugene Azimut
+             */
+            ListArg(
+                std::vector<std::string> &Output,
+
+                const Flags &FlagsList,
+                const std::string &Help = "",
+                uint32_t NArgs = 1,
+                bool IsRequired   = false,
+                bool IsDeprecated = false,
+
+                char Delimiter = '\0',
+                const std::vector<std::string> &DefaultValue = {}
+            );
+
+            /**
+             * @brief Default constructor
+             * @details Creates new instance of list CLI argument.\n
+             * This constructor is appliable to initializers:
+             * @code {.cpp}
+             *     ListArg(
+             *         MyVar,
+             *         {"-H", "--hosts"},
+             *         "Help message",
+             *         1,
+             *         false, false,
+             *         ',', {}
+             *     );
+             * @endcode
+             *
+             * @param[out] Output Reference to a variable in which value will be placed
+             * @param[in] FlagsList Either a name or a list of option strings
+             * @param[in] Help A brief description of what the argument does
+             * @param[in] NArgs The number of command-line arguments that should be consumed.\n
+             * Any value except NARGS::NO_MORE
+             * @param[in] IsRequired Whether or not the command-line option may be omitted (optionals only)
+             * @param[in] IsDeprecated Whether or not use of the argument is deprecated
+             *
+             * @param[in] Delimiter Character which splits values into items. '\\0' disables splitting
+             * @param[in] DefaultValue Default items if flag wasn't recognized
+             *
+             * @throw std::bad_alloc in case of memory allocation failure
+             * @throw std::invalid_argument in case of invalid NArgs value
+             *
+             * @version 1.0.0
+             * @authors Eugene Azimut
+             */
+            ListArg(
+                std::vector<std::string> &Output,
+
+                Flags &&FlagsList,
+                const std::string &Help = "",
+                uint32_t NArgs = 1,
+                bool IsRequired   = false,
+                bool IsDeprecated = false,
+
+                char Delimiter = '\0',
+                const std::vector<std::string> &DefaultValue = {}
+            );
+
+            /**
+             * @brief Copy constructor
+             * @details Creates new instance of list CLI argument as a copy of Other
+             *
+             * @param[in] Other Instance to copy
+             *
+             * @throw std::bad_alloc in case of memory allocation failure
+             *
+             * @version 1.0.0
+             * @authors Eugene Azimut
+             */
+            ListArg(const ListArg &Other);
+
+            /**
+             * @brief Move constructor
+             * @details Creates new instance of list CLI argument moving Other
+             *
+             * @param[in] Other Instance to move
+             *
+             * @version 1.0.0
+             * @authors Eugene Azimut
+             */
+            ListArg(ListArg &&Other) noexcept;
+
+            /**
+             * @brief Destroies instance of list CLI argument
+             *
+             * @version 1.0.0
+             * @authors Eugene Azimut
+             */
+            virtual ~ListArg() noexcept;
+
+        //* Getters and setters
+            /**
+             * @brief Set the number of command-line arguments that should be consumed
+             * @param[in] NArgs The number of command-line arguments that should be consumed.\n
+             * Any value except NARGS::NO_MORE
+             *
+             * @throw std::invalid_argument in case of invalid NArgs value
+             *
+             * @version 1.0.0
+             * @authors Eugene Azimut
+             */
+            virtual void setNArgs(uint32_t NArgs) override;
+
+            /**
+             * @brief Returns the pointer to output variable
+             * @return Pointer to output variable
+             *
+             * @version 1.0.0
+             * @authors Eugene Azimut
+             */
+            virtual std::vector<std::string> *getOutput() const;
+
+            /**
+             * @brief Returns character which splits values into items
+             * @return Delimiter or '\\0' if splitting is disabled
+             *
+             * @version 1.0.0
+             * @authors Eugene Azimut
+             */
+            virtual char getDelimiter() const;
+
+            /**
+             * @brief Sets character which splits values into items
+             * @param[in] Delimiter Delimiter or '\\0' to disable splitting
+             *
+             * @version 1.0.0
+             * @authors Eugene Azimut
+             */
+            virtual void setDelimiter(char Delimiter);
+
+            /**
+             * @brief Returns default items if flag wasn't recognized
+             * @return Default items if flag wasn't recognized
+             *
+             * @version 1.0.0
+             * @authors Eugene Azimut
+             */
+            virtual const std::vector<std::string> &getDefaultValue() const;
+
+            /**
+             * @brief Sets default items if flag wasn't recognized
+             * @param[in] Value Default items if flag wasn't recognized
+             *
+             * @throw std::bad_alloc in case of memory allocation failure
+             *
+             * @version 1.0.0
+             * @authors Eugene Azimut
+             */
+            virtual void setDefaultValue(const std::vector<std::string> &Value);
+
+        //* Parsing callbacks
+            /**
+             * @brief Places DefaultValue in output variable
+             *
+             * @throw std::bad_alloc in case of memory allocation failure
+             *
+             * @version 1.0.0
+             * @authors Eugene Azimut
+             */
+            virtual void applyDefault() override;
+
+            /**
+             * @brief Reserves output variable for Count more items
+             * @param[in] Count Number of upcoming values
+             *
+             * @throw std::bad_alloc in case of memory allocation failure
+             *
+             * @version 1.0.0
+             * @authors Eugene Azimut
+             */
+            virtual void reserveValues(uint32_t Count) override;
+
+            /**
+             * @brief Drops default items on the first occurrence
+             *
+             * @version 1.0.0
+             * @authors Eugene Azimut
+             */
+            virtual void applyFlag() override;
+
+            /**
+             * @brief Splits Value by delimiter and appends items to output variable
+             * @param[in] Value One or more delimited items
+             *
+             * @throw std::bad_alloc in case of memory allocation failure
+             *
+             * @version 1.0.0
+             * @authors Eugene Azimut
+             */
+            virtual void applyValue(const StringView &Value) override;
+
+        private:
+            /**
+             * @brief Copies current class members
+             * @details The method copies members of only the given class,
+             * even if it is an inheritor, and lets avoid repeating code
+             * in the copy constructor and copy assignment operator
+             *
+             * @param[in] Other Instance to copy
+             *
+             * @version 1.0.0
+             * @authors Eugene Azimut
+             */
+            void selfCopy(const ListArg &Other);
+
+            /**
+             * @brief Moves current class members
+             * @details The method moves members of only the given class,
+             * even if it is an inheritor, and lets avoid repeating code
+             * in the move constructor and move assignment operator
+             *
+             * @param[in] Other Instance to move
+             *
+             * @version 1.0.0
+             * @authors Eugene Azimut
+             */
+            void selfMove(ListArg &&Other) noexcept;
+
+        //* Variables
+            std::vector<std::string> *mOutput;          ///< Pointer to a variable in which items will be placed
+            std::vector<std::string>  mDefaultValue;    ///< Default items if flag wasn't recognized
+            char                      mDelimiter;       ///< Splits values into items. '\\0' disables splitting
+            bool                      mIsDefault;       ///< Output variable holds default items
+        };
+    }
+}
@@ -0,0 +1,394 @@
+/**
+ * @file NumericArg.hpp
+ * @brief Declaration of numeric CLI arguments
+ *
+ * @version 1.0.0
+ * @authors Eugene Azimut
+ * @copyright Copyright (c) Eugene Azimut, 2026
+ */
+#pragma once
+#include "../api.hpp"
+#include "IOptionalArgument.hpp"
+
+#include <stdexcept>
+#include <type_traits>
+
+
+
+namespace argparse {
+    namespace args {
+        /**
+         * @class NumericArg
+         * @brief Contains definition and parameters of numeric CLI argument
+         * @details This argument type is desired to store a command-line argument
+         * of an integer, unsigned or floating-point type.\n
+         * Values are converted without locale, streams and allocations:
+         *   * Integers: optional sign ('-' only for signed types) followed by
+         *     decimal digits or "0x" and hexadecimal digits, e.g. "42", "-7", "0xff";
+         *   * Floating-point numbers: optional sign, digits with optional
+         *     fraction and exponent, e.g. "1.5", "-.5", "2e-3", or
+         *     "inf", "infinity", "nan" (case-insensitive)
+         *
+         * Values which don't fit T and values outside of [Min, Max]
+         * (see NumericArg::setRange(T, T)) are rejected with precise messages.\n
+         * Example:
+         * @code {.cpp}
+         *     unsigned Threads = 0;
+         *     Parser.addArgument(UnsignedArg(Threads, {"-j", "--jobs"}, "Number of threads"))
+         *         .setRange(1, 256);
+         * @endcode
+         * Command line:
+         * @code {.sh}
+         *     ./my_prog --jobs 16
+         * @endcode
+         * Result:
+         * @code
+         *     Threads = 16
+         * @endcode
+         *
+         * @tparam T One of: short, int, long, long long, their unsigned versions, float, double
+         *
+         * @version 1.0.0
+         * @authors Eugene Azimut
+         */
+        template<typename T>
+        ARGPARSE_API class NumericArg: public IOptionalArgument {
+            static_assert(
+                std::is_arithmetic<T>::value && !std::is_same<T, bool>::value,
+                "T must be an integer or floating-point type"
+            );
+
+        public:
+        //* Ctors and dtor
+            /**
+             * @brief Default constructor
+             * @details Creates new instance of numeric CLI argument
+             *
+             * @param[out] Output Reference to a variable in which value will be placed
+             * @param[in] FlagsList Either a name or a list of option strings
+             * @param[in] Help A brief description of what the argument does
+             * @param[in] NArgs The number of command-line arguments that should be consumed.\n
+             * Available values:
+             *   * 1;
+             *   * NARGS::ZERO_OR_ONE
+             * @param[in] IsRequired Whether or not the command-line option may be omitted (optionals only)
+             * @param[in] IsDeprecated Whether or not use of the argument is deprecated
+             *
+             * @param[in] StoreValue Value if flag recognized and value wasn't passed
+             * @param[in] DefaultValue Default value if flag wasn't recognized
+             *
+             * @throw std::bad_alloc in case of memory allocation failure
+             * @throw std::invalid_argument in case of invalid NArgs value
+             *
+             * @version 1.0.0
+             * @authors Eugene Azimut
+             */
+            NumericArg(
+                T &Output,
+
+                const Flags &FlagsList,
+                const std::string &Help = "",
+                uint32_t NArgs = 1,
+                bool IsRequired   = false,
+                bool IsDeprecated = false,
+
+                T StoreValue   = T(),
+                T DefaultValue = T()
+            );
+
+            /**
+             * @brief Default constructor
+             * @details Creates new instance of numeric CLI argument.\n
+             * This constructor is appliable to initializers:
+             * @code {.cpp}
+             *     IntegerArg(
+             *         MyVar,
+             *         {"-n", "--number"},
+             *         "Help message",
+             *         1,
+             *         false, false,
+             *         0, 0
+             *     );
+             * @endcode
+             *
+             * @param[out] Output Reference to a variable in which value will be placed
+             * @param[in] FlagsList Either a name or a list of option strings
+             * @param[in] Help A brief description of what the argument does
+             * @param[in] NArgs The number of command-line arguments that should be consumed.\n
+             * Available values:
+             *   * 1;
+             *   * NARGS::ZERO_OR_ONE
+             * @param[in] IsRequired Whether or not the command-line option may be omitted (optionals only)
+             * @param[in] IsDeprecated Whether or not use of the argument is deprecated
+             *
+             * @param[in] StoreValue Value if flag recognized and value wasn't passed
+             * @param[in] DefaultValue Default value if flag wasn't recognized
+             *
+             * @throw std::bad_alloc in case of memory allocation failure
+             * @throw std::invalid_argument in case of invalid NArgs value
+             *
+             * @version 1.0.0
+             * @authors Eugene Azimut
+             */
+            NumericArg(
+                T &Output,
+
+                Flags &&FlagsList,
+                const std::string &Help = "",
+                uint32_t NArgs = 1,
+                bool IsRequired   = false,
+                bool IsDeprecated = false,
+
+                T StoreValue   = T(),
+                T DefaultValue = T()
+            );
+
+            /**
+             * @brief Copy constructor
+             * @details Creates new instance of numeric CLI argument as a copy of Other
+             *
+             * @param[in] Other Instance to copy
+             *
+             * @throw std::bad_alloc in case of memory allocation failure
+             *
+             * @version 1.0.0
+             * @authors Eugene Azimut
+             */
+            NumericArg(const NumericArg &Other);
+
+            /**
+             * @brief Move constructor
+             * @details Creates new instance of numeric CLI argument moving Other
+             *
+             * @param[in] Other Instance to move
+             *
+             * @version 1.0.0
+             * @authors Eugene Azimut
+             */
+            NumericArg(NumericArg &&Other) noexcept;
+
+            /**
+             * @brief Destroies instance of numeric CLI argument
+             *
+             * @version 1.0.0
+             * @authors Eugene Azimut
+             */
+            virtual ~NumericArg() noexcept;
+
+        //* Getters and setters
+            /**
+             * @brief Set the number of command-line arguments that should be consumed
+             * @param[in] NArgs The number of command-line arguments that should be consumed.\n
+             * Available values:
+             *   * 1;
+             *   * NARGS::ZERO_OR_ONE
+             *
+             * @throw std::invalid_argument in case of invalid NArgs value
+             *
+             * @version 1.0.0
+             * @authors Eugene Azimut
+             */
+            virtual void setNArgs(uint32_t NArgs) override;
+
+            /**
+             * @brief Returns the pointer to output variable
+             * @return Pointer to output variable
+             *
+             * @version 1.0.0
+             * @authors Eugene Azimut
+             */
+            virtual T *getOutput() const;
+
+            /**
+             * @brief Returns value if flag recognized and value wasn't passed
+             * @return Value if flag recognized and value wasn't passed
+             *
+             * @version 1.0.0
+             * @authors Eugene Azimut
+             */
+            virtual T getStoreValue() const;
+
+            /**
+             * @brief Sets value if flag recognized and value wasn't passed
+             * @param[in] Value Value if flag recognized and value wasn't passed
+             *
+             * @version 1.0.0
+             * @authors Eugene Azimut
+             */
+            virtual void setStoreValue(T Value);
+
+            /**
+             * @brief Returns default value if flag wasn't recognized
+             * @return Default value if flag wasn't recognized
+             *
+             * @version 1.0.0
+             * @authors Eugene Azimut
+             */
+            virtual T getDefaultValue() const;
+
+            /**
+             * @brief Sets default value if flag wasn't recognized
+             * @param[in] Value Default value if flag wasn't recognized
+             *
+             * @version 1.0.0
+             * @authors Eugene Azimut
+             */
+            virtual void setDefaultValue(T Value);
+
+            /**
+             * @brief Returns minimum accepted value
+             * @return Minimum accepted value. Default: the lowest value of T (-infinity for floating-point types)
+             *
+             * @version 1.0.0
+             * @authors Eugene Azimut
+             */
+            virtual T getMin() const;
+
+            /**
+             * @brief Returns maximum accepted value
+             * @return Maximum accepted value. Default: the highest value of T (+infinity for floating-point types)
+             *
+             * @version 1.0.0
+             * @authors Eugene Azimut
+             */
+            virtual T getMax() const;
+
+            /**
+             * @brief Sets range of accepted values
+             * @param[in] Min Minimum accepted value
+             * @param[in] Max Maximum accepted value
+             *
+             * @throw std::invalid_argument in case Min is greater than Max
+             *
+             * @version 1.0.0
+             * @authors Eugene Azimut
+             */
+            virtual void setRange(T Min, T Max);
+
+        //* Parsing callbacks
+            /**
+             * @brief Places DefaultValue in output variable
+             *
+             * @version 1.0.0
+             * @authors Eugene Azimut
+             */
+            virtual void applyDefault() override;
+
+            /**
+             * @brief Places StoreValue in output variable
+             *
+             * @version 1.0.0
+             * @authors Eugene Azimut
+             */
+            virtual void applyFlag() override;
+
+            /**
+             * @brief Checks that Value is a number fitting T and [Min, Max]
+             * @param[in] Value Number, see NumericArg for accepted formats
+             * @return ErrorCode::SUCCESS, ErrorCode::INVALID_VALUE for malformed numbers,
+             * ErrorCode::VALUE_OUT_OF_RANGE for numbers which don't fit T or are outside of [Min, Max]
+             *
+             * @version 1.0.0
+             * @authors Eugene Azimut
+             */
+            virtual ErrorCode validateValue(const StringView &Value) const noexcept override;
+
+            /**
+             * @brief Converts Value and places it in output variable
+             * @details Throwing wrapper over the check of NumericArg::validateValue(const StringView &) const
+             *
+             * @param[in] Value Number, see NumericArg for accepted formats
+             *
+             * @throw std::runtime_error in case of invalid number,
+             * number which doesn't fit T or is outside of [Min, Max]
+             *
+             * @version 1.0.0
+             * @authors Eugene Azimut
+             */
+            virtual void applyValue(const StringView &Value) override;
+
+        private:
+            /**
+             * @brief Copies current class members
+             * @details The method copies members of only the given class,
+             * even if it is an inheritor, and lets avoid repeating code
+             * in the copy constructor and copy assignment operator
+             *
+             * @param[in] Other Instance to copy
+             *
+             * @version 1.0.0
+             * @authors Eugene Azimut
+             */
+            void selfCopy(const NumericArg &Other);
+
+            /**
+             * @brief Moves current class members
+             * @details The method moves members of only the given class,
+             * even if it is an inheritor, and lets avoid repeating code
+             * in the move constructor and move assignment operator
+             *
+             * @param[in] Other Instance to move
+             *
+             * @version 1.0.0
+             * @authors Eugene Azimut
+             */
+            void selfMove(NumericArg &&Other) noexcept;
+
+        //* Variables
+            T *mOutput;             ///< Pointer to a variable in which value will be placed
+            T  mStoreValue;         ///< Value if flag recognized and value wasn't passed
+            T  mDefaultValue;       ///< Default value if flag wasn't recognized
+            T  mMin;                ///< Minimum accepted value
+            T  mMax;                ///< Maximum accepted value
+        };
+
+        /** @cond IGNORE */
+        extern template class NumericArg<short>;
+        extern template class NumericArg<int>;
+        extern template class NumericArg<long>;
+        extern template class NumericArg<long long>;
+        extern template class NumericArg<unsigned short>;
+        extern template class NumericArg<unsigned int>;
+        extern template class NumericArg<unsigned long>;
+        extern template class NumericArg<unsigned long long>;
+        extern template class NumericArg<float>;
+        extern template class NumericArg<double>;
+        /** @endcond */
+
+        /**
+         * @typedef NumericArg<int> IntegerArg
+         * @brief Signed integer CLI argument
+         *
+         * @version 1.0.0
+         * @authors Eugene Azimut
+         */
+        using IntegerArg = NumericArg<int>;
+
+        /**
+         * @typedef NumericArg<unsigned> UnsignedArg
+         * @brief Unsigned integer CLI argument
+         *
+         * @version 1.0.0
+         * @authors Eugene Azimut
+         */
+        using UnsignedArg = NumericArg<unsigned>;
+
+        /**
+         * @typedef NumericArg<float> FloatArg
+         * @brief Single precision floating-point CLI argument
+         *
+         * @version 1.0.0
+         * @authors Eugene Azimut
+         */
+        using FloatArg = NumericArg<float>;
+
+        /**
+         * @typedef NumericArg<double> DoubleArg
+         * @brief Double precision floating-point CLI argument
+         *
+         * @version 1.0.0
+         * @authors Eugene Azimut
+         */
+        using DoubleArg = NumericArg<double>;
+    }
+}
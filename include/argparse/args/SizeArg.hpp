@@ -0,0 +1,299 @@
+/**
+ * @file SizeArg.hpp
+ * @brief Declaration of byte size CLI argument
+ *
+ * @version 1.0.0
+ * @authors Eugene Azimut
+ * @copyright Copyright (c) Eugene Azimut, 2026
+ */
+#pragma once
+#include "../api.hpp"
+#include "IOptionalArgument.hpp"
+
+#include <cstdint>
+
+
+
+namespace argparse {
+    namespace args {
+        /**
+         * @class SizeArg
+         * @brief Contains definition and parameters of byte size CLI argument
+         * @details This argument type is desired to store a command-line argument
+         * of a size in bytes. Value is a decimal number with optional fraction
+         * and optional unit, e.g. "4096", "64KiB", "1.5G", "10MB".\n
+         * Units are case-insensitive:
+         *   * "B" or no unit - bytes;
+         *   * "K", "M", "G", "T", "P", "E" and "KiB", "MiB", ..., "EiB" - powers of 1024;
+         *   * "KB", "MB", "GB", "TB", "PB", "EB" - powers of 1000
+         *
+         * The result is exact: fractional bytes are truncated ("0.1K" is 102).
+         * Values exceeding 2^64 - 1 bytes are rejected.\n
+         * Example:
+         * @code {.cpp}
+         *     uint64_t CacheSize = 0;
+         *     Parser.addArgument(SizeArg(CacheSize, {"--cache-size"}, "Cache size"));
+         * @endcode
+         * Command line:
+         * @code {.sh}
+         *     ./my_prog --cache-size 1.5G
+         * @endcode
+         * Result:
+         * @code
+         *     CacheSize = 1610612736
+         * @endcode
+         *
+         * @version 1.0.0
+         * @authors Eugene Azimut
+         */
+        ARGPARSE_API class SizeArg: public IOptionalArgument {
+        public:
+        //* Ctors and dtor
+            /**
+             * @brief Default constructor
+             * @details Creates new instance of byte size CLI argument
+             *
+             * @param[out] Output Reference to a variable in which value will be placed
+             * @param[in] FlagsList Either a name or a list of option strings
+             * @param[in] Help A brief description of what the argument does
+             * @param[in] NArgs The number of command-line arguments that should be consumed.\n
+             * Available values:
+             *   * 1;
+             *   * NARGS::ZERO_OR_ONE
+             * @param[in] IsRequired Whether or not the command-line option may be omitted (optionals only)
+             * @param[in] IsDeprecated Whether or not use of the argument is deprecated
+             *
+             * @param[in] StoreValue Value if flag recognized and value wasn't passed
+             * @param[in] DefaultValue Default value if flag wasn't recognized
+             *
+             * @throw std::bad_alloc in case of memory allocation failure
+             * @throw std::invalid_argument in case of invalid NArgs value
+             *
+             * @version 1.0.0
+             * @authors Eugene Azimut
+             */
+            SizeArg(
+                uint64_t &Output,
+
+                const Flags &FlagsList,
+                const std::string &Help = "",
+                uint32_t NArgs = 1,
+                bool IsRequired   = false,
+                bool IsDeprecated = false,
+
+                uint64_t StoreValue   = 0,
+                uint64_t DefaultValue = 0
+            );
+
+            /**
+             * @brief Default constructor
+             * @details Creates new instance of byte size CLI argument.\n
+             * This constructor is appliable to initializers:
+             * @code {.cpp}
+             *     SizeArg(
+             *         MyVar,
+             *         {"-s", "--size"},
+             *         "Help message",
+             *         1,
+             *         false, false,
+             *         0, 0
+             *     );
+             * @endcode
+             *
+             * @param[out] Output Reference to a variable in which value will be placed
+             * @param[in] FlagsList Either a name or a list of option strings
+             * @param[in] Help A brief description of what the argument does
+             * @param[in] NArgs The number of command-line arguments that should be consumed.\n
+             * Available values:
+             *   * 1;
+             *   * NARGS::ZERO_OR_ONE
+             * @param[in] IsRequired Whether or not the command-line option may be omitted (optionals only)
+             * @param[in] IsDeprecated Whether or not use of the argument is deprecated
+             *
+             * @param[in] StoreValue Value if flag recognized and value wasn't passed
+             * @param[in] DefaultValue Default value if flag wasn't recognized
+             *
+             * @throw std::bad_alloc in case of memory allocation failure
+             * @throw std::invalid_argument in case of invalid NArgs value
+             *
+             * @version 1.0.0
+             * @authors Eugene Azimut
+             */
+            SizeArg(
+                uint64_t &Output,
+
+                Flags &&FlagsList,
+                const std::string &Help = "",
+                uint32_t NArgs = 1,
+                bool IsRequired   = false,
+                bool IsDeprecated = false,
+
+                uint64_t StoreValue   = 0,
+                uint64_t DefaultValue = 0
+            );
+
+            /**
+             * @brief Copy constructor
+             * @details Creates new instance of byte size CLI argument as a copy of Other
+             *
+             * @param[in] Other Instance to copy
+             *
+             * @throw std::bad_alloc in case of memory allocation failure
+             *
+             * @version 1.0.0
+             * @authors Eugene Azimut
+             */
+            SizeArg(const SizeArg &Other);
+
+            /**
+             * @brief Move constructor
+             * @details Creates new instance of byte size CLI argument moving Other
+             *
+             * @param[in] Other Instance to move
+             *
+             * @version 1.0.0
+             * @authors Eugene Azimut
+             */
+            SizeArg(SizeArg &&Other) noexcept;
+
+            /**
+             * @brief Destroies instance of byte size CLI argument
+             *
+             * @version 1.0.0
+             * @authors Eugene Azimut
+             */
+            virtual ~SizeArg() noexcept;
+
+        //* Getters and setters
+            /**
+             * @brief Set the number of command-line arguments that should be consumed
+             * @param[in] NArgs The number of command-line arguments that should be consumed.\n
+             * Available values:
+             *   * 1;
+             *   * NARGS::ZERO_OR_ONE
+             *
+             * @throw std::invalid_argument in case of invalid NArgs value
+             *
+             * @version 1.0.0
+             * @authors Eugene Azimut
+             */
+            virtual void setNArgs(uint32_t NArgs) override;
+
+            /**
+             * @brief Returns the pointer to output variable
+             * @return Pointer to output variable
+             *
+             * @version 1.0.0
+             * @authors Eugene Azimut
+             */
+            virtual uint64_t *getOutput() const;
+
+            /**
+             * @brief Returns value if flag recognized and value wasn't passed
+             * @return Value if flag recognized and value wasn't passed
+             *
+             * @version 1.0.0
+             * @authors Eugene Azimut
+             */
+            virtual uint64_t getStoreValue() const;
+
+            /**
+             * @brief Sets value if flag recognized and value wasn't passed
+             * @param[in] Value Value if flag recognized and value wasn't passed
+             *
+             * @version 1.0.0
+             * @authors Eugene Azimut
+             */
+            virtual void setStoreValue(uint64_t Value);
+
+            /**
+             * @brief Returns default value if flag wasn't recognized
+             * @return Default value if flag wasn't recognized
+             *
+             * @version 1.0.0
+             * @authors Eugene Azimut
+             */
+            virtual uint64_t getDefaultValue() const;
+
+            /**
+             * @brief Sets default value if flag wasn't recognized
+             * @param[in] Value Default value if flag wasn't recognized
+             *
+             * @version 1.0.0
+             * @authors Eugene Azimut
+             */
+            virtual void setDefaultValue(uint64_t Value);
+
+        //* Parsing callbacks
+            /**
+             * @brief Places DefaultValue in output variable
+             *
+             * @version 1.0.0
+             * @authors Eugene Azimut
+             */
+            virtual void applyDefault() override;
+
+            /**
+             * @brief Places StoreValue in output variable
+             *
+             * @version 1.0.0
+             * @authors Eugene Azimut
+             */
+            virtual void applyFlag() override;
+
+            /**
+             * @brief Checks that Value is a size fitting 64 bits
+             * @param[in] Value Size, see SizeArg for accepted formats
+             * @return ErrorCode::SUCCESS, ErrorCode::INVALID_VALUE for malformed sizes and unknown units,
+             * ErrorCode::VALUE_OUT_OF_RANGE for sizes which don't fit 64 bits
+             *
+             * @version 1.0.0
+             * @authors Eugene Azimut
+             */
+            virtual ErrorCode validateValue(const StringView &Value) const noexcept override;
+
+            /**
+             * @brief Converts Value and places it in output variable
+             * @param[in] Value Size, see SizeArg for accepted formats
+             *
+             * @throw std::runtime_error in case of invalid size or size which doesn't fit 64 bits
+             *
+             * @version 1.0.0
+             * @authors Eugene Azimut
+             */
+            virtual void applyValue(const StringView &Value) override;
+
+        private:
+            /**
+             * @brief Copies current class members
+             * @details The method copies members of only the given class,
+             * even if it is an inheritor, and lets avoid repeating code
+             * in the copy constructor and copy assignment operator
+             *
+             * @param[in] Other Instance to copy
+             *
+             * @version 1.0.0
+             * @authors Eugene Azimut
+             */
+            void selfCopy(const SizeArg &Other);
+
+            /**
+             * @brief Moves current class members
+             * @details The method moves members of only the given class,
+             * even if it is an inheritor, and lets avoid repeating code
+             * in the move constructor and move assignment operator
+             *
+             * @param[in] Other Instance to move
+             *
+             * @version 1.0.0
+             * @authors Eugene Azimut
+             */
+            void selfMove(SizeArg &&Other) noexcept;
+
+        //* Variables
+            uint64_t *mOutput;          ///< Pointer to a variable in which value will be placed
+            uint64_t  mStoreValue;      ///< Value if flag recognized and value wasn't passed
+            uint64_t  mDefaultValue;    ///< Default value if flag wasn't recognized
+        };
+    }
+}
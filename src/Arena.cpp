@@ -0,0 +1,125 @@
+/**
+ * @file Arena.cpp
+ * @brief Definition of monotonic arena allocator
+ *
+ * @version 1.0.0
+ * @authors Eugene Azimut
+ * @copyright Copyright (c) Eugene Azimut, 2026
+ */
+#include <argparse/Arena.hpp>
+#include <argparse/helpers.hpp>
+
+#include <cstdint>
+#include <new>
+
+using namespace std;
+using namespace argparse;
+
+
+
+constexpr size_t Arena::DEFAULT_BLOCK_SIZE;
+
+
+
+Arena::Arena(size_t BlockSize):
+mHead(nullptr), mCursor(nullptr), mEnd(nullptr),
+mBlockSize(BlockSize ? BlockSize : DEFAULT_BLOCK_SIZE),
+mUsed(0), mCapacity(0) {}
+
+Arena::Arena(Arena &&Other) noexcept:
+mHead(exchange_basic(Other.mHead, nullptr)),
+mCursor(exchange_basic(Other.mCursor, nullptr)),
+mEnd(exchange_basic(Other.mEnd, nullptr)),
+mBlockSize(Other.mBlockSize),
+mUsed(exchange_basic(Other.mUsed, 0)),
+mCapacity(exchange_basic(Other.mCapacity, 0)) {}
+
+Arena::~Arena() noexcept {
+    release();
+}
+
+Arena &Arena::operator=(Arena &&Other) noexcept {
+    if (this != &Other) {
+        release();
+        mHead      = exchange_basic(Other.mHead, nullptr);
+        mCursor    = exchange_basic(Other.mCursor, nullptr);
+        mEnd       = exchange_basic(Other.mEnd, nullptr);
+        mBlockSize = Other.mBlockSize;
+        mUsed      = exchange_basic(Other.mUsed, 0);
+        mCapacity  = exchange_basic(Other.mCapacity, 0);
+    }
+    return *this;
+}
+
+size_t Arena::getBlockSize() const {
+    return mBlockSize;
+}
+
+void Arena::setBlockSize(size_t BlockSize) {
+    mBlockSize = BlockSize ? BlockSize : DEFAULT_BLOCK_SIZE;
+}
+
+size_t Arena::getUsed() const {
+    return mUsed;
+}
+
+size_t Arena::getCapacity() const {
+    return mCapacity;
+}
+
+void *Arena::allocate(size_t Size, size_t Align) {
+    uintptr_t Address = reinterpret_cast<uintptr_t>(mCursor);
+    size_t Padding = (Align - (Address & (Align - 1))) & (Align - 1);
+
+    if (!mHead || Size + Padding > static_cast<size_t>(mEnd - mCursor)) {
+        grow(Size + Align);
+        Address = reinterpret_cast<uintptr_t>(mCursor);
+        Padding = (Align - (Address & (Align - 1))) & (Align - 1);
+    }
+
+    char *Result = mCursor + Padding;
+    mCursor = Result + Size;
+    mUsed  += Size + Padding;
+    return Result;
+}
+
+void Arena::reset() {
+    if (mHead && mHead->Prev) {
+        // Several blocks were used: replace them with one block fitting everything
+        const size_t Total = mCapacity;
+        release();
+        grow(Total);
+    }
+
+    if (mHead) {
+        mCursor = reinterpret_cast<char *>(mHead + 1);
+        mEnd    = mCursor + mHead->Size;
+    }
+    mUsed = 0;
+}
+
+void Arena::grow(size_t MinSize) {
+    size_t Size = mHead ? mHead->Size * 2 : mBlockSize;
+    if (Size < MinSize) Size = MinSize;
+
+    Block *New = static_cast<Block *>(::operator new(sizeof(Block) + Size));
+    New->Prev = mHead;
+    New->Size = Size;
+
+    mHead      = New;
+    mCursor    = reinterpret_cast<char *>(New + 1);
+    mEnd       = mCursor + Size;
+    mCapacity += Size;
+}
+
+void Arena::release() noexcept {
+    while (mHead) {
+        Block *Prev = mHead->Prev;
+        ::operator delete(mHead);
+        mHead = Prev;
+    }
+    mCursor   = nullptr;
+    mEnd      = nullptr;
+    mUsed     = 0;
+    mCapacity = 0;
+}
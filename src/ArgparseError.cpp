@@ -0,0 +1,68 @@
+/**
+ * @file ArgparseError.cpp
+ * @brief Definition of non-throwing parsing errors
+ *
+ * @version 1.0.0
+ * @authors Eugene Azimut
+ * @copyright Copyright (c) Eugene Azimut, 2026
+ */
+#include <argparse/ArgparseError.hpp>
+
+using namespace std;
+using namespace argparse;
+
+
+
+const char *argparse::getErrorMessage(ErrorCode Code) noexcept {
+    switch (Code) {
+        case SUCCESS:
+            return "success";
+        case NOT_AN_OPTION:
+            return "Not an optional";
+        case OPTION_NOT_PROVIDED:
+            return "Option wasn't provided";
+        case DELIMITER_AS_OPTION:
+            return "Value delimiter (\"=\") cannot be an option";
+        case SHORT_OPTION_DELIMITER:
+            return "UnixStyle doesn't support value delimiters in short options";
+        case UNRECOGNIZED_OPTION:
+            return "unrecognized option";
+        case UNRECOGNIZED_ARGUMENT:
+            return "unrecognized argument";
+        case UNEXPECTED_VALUE:
+            return "option doesn't accept values";
+        case EXPECTED_MORE_VALUES:
+            return "expected more values for option";
+        case RESPONSE_FILE_UNREADABLE:
+            return "can't read response file";
+        case RESPONSE_FILE_QUOTE:
+            return "unterminated quote in response file";
+        case RESPONSE_FILE_DEPTH:
+            return "response files nested too deeply";
+        case AMBIGUOUS_OPTION:
+            return "ambiguous option";
+        case CONFIG_FILE_UNREADABLE:
+            return "can't read config file";
+        case CONFIG_FILE_SYNTAX:
+            return "invalid line in config file";
+        case UNRECOGNIZED_CONFIG_KEY:
+            return "unrecognized key in config file";
+        case MISSING_REQUIRED_OPTION:
+            return "missing required option";
+        case EXCLUSIVE_OPTIONS:
+            return "option is mutually exclusive with another one";
+        case MISSING_GROUP_OPTION:
+            return "one of options is required";
+        case MISSING_DEPENDENCY:
+            return "option requires another one";
+        case INVALID_OPTION:
+            return "Invalid option (option not provided)";
+        case INVALID_VALUE:
+            return "invalid value";
+        case VALUE_OUT_OF_RANGE:
+            return "value out of range";
+    }
+
+    // gag
+    return "unknown error";
+}
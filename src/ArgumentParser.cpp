@@ -8,60 +8,1420 @@
  */
 #include <argparse/ArgumentParser.hpp>
 #include <argparse/helpers.hpp>
+#include "simd.hpp"
 
-#include <list>
+#include <algorithm>
+#include <cctype>
+#include <cerrno>
+#include <cstdlib>
+#include <cstring>
+#include <stdexcept>
 #include <utility>
 
+#if defined(_WIN32)
+    #include <io.h>
+    #define ARGPARSE_ENVIRON _environ
+#else
+    #include <unistd.h>
+    extern char **environ;
+    #define ARGPARSE_ENVIRON environ
+#endif
+
 using namespace std;
 using namespace argparse;
+using namespace argparse::args;
+using namespace argparse::OptStyles;
+using argparse::detail::lowestBit;
+
+
+
+namespace {
+    /**
+     * @brief Sentinel for unlimited number of values
+     */
+    constexpr uint32_t UNLIMITED = UINT32_MAX;
+
+    /**
+     * @brief Converts NArgs into minimum and maximum number of values
+     * @param[in] NArgs The number of command-line arguments that should be consumed
+     * @param[out] Min Minimum number of values
+     * @param[out] Max Maximum number of values or UNLIMITED
+     */
+    void getValuesRange(uint32_t NArgs, uint32_t &Min, uint32_t &Max) {
+        switch (NArgs) {
+            case NARGS::ZERO_OR_ONE:
+                Min = 0; Max = 1;
+                break;
+            case NARGS::ZERO_AND_MORE:
+                Min = 0; Max = UNLIMITED;
+                break;
+            case NARGS::ONE_AND_MORE:
+                Min = 1; Max = UNLIMITED;
+                break;
+            default:
+                Min = NArgs; Max = NArgs;
+                break;
+        }
+    }
+
+    /**
+     * @brief Checks if Arg is a negative number like "-1", "-.5" or "-2e3"
+     * @details Such arguments are treated as values unless they match a registered flag
+     */
+    bool isNegativeNumber(const StringView &Arg) {
+        if (Arg.size() < 2 || Arg[0] != '-') return false;
+
+        size_t i = 1;
+        if (Arg[i] == '.') ++i;
+        return i < Arg.size() && Arg[i] >= '0' && Arg[i] <= '9';
+    }
+
+    /**
+     * @brief Computes optimal string alignment distance (Damerau-Levenshtein
+     * without repeated edits of one substring) between pattern and Text
+     * @details Bit-parallel algorithm of Myers with transpositions by Hyyro:
+     * one column of the distance matrix is a pair of bit vectors, so every character
+     * of Text costs a few word operations. Stops as soon as the distance
+     * can't drop to Max any more
+     *
+     * @param[in] Masks Bit i of Masks[c] is set if pattern[i] == c
+     * @param[in] PatternSize Size of pattern, at most 64
+     * @param[in] Text Compared string
+     * @param[in] Max Maximum distance of interest
+     * @return Distance or Max + 1 if it exceeds Max
+     */
+    size_t osaDistance(const uint64_t Masks[256], size_t PatternSize, const StringView &Text, size_t Max) {
+        const size_t Gap = PatternSize > Text.size() ? PatternSize - Text.size() : Text.size() - PatternSize;
+        if (Gap > Max) return Max + 1;
+        if (PatternSize == 0) return Text.size();
+
+        const uint64_t Last = UINT64_C(1) << (PatternSize - 1);
+        uint64_t VP = ~UINT64_C(0), VN = 0, D0 = 0, PrevMask = 0;
+        size_t Distance = PatternSize;
+        for (size_t j = 0; j < Text.size(); ++j) {
+            const uint64_t Mask = Masks[static_cast<unsigned char>(Text[j])];
+            const uint64_t TR = (((~D0) & Mask) << 1) & PrevMask;
+            D0 = ((((Mask & VP) + VP) ^ VP) | Mask | VN) | TR;
+
+            uint64_t HP = VN | ~(D0 | VP);
+            uint64_t HN = D0 & VP;
+            if (HP & Last) ++Distance;
+            if (HN & Last) --Distance;
+
+            HP = (HP << 1) | 1;
+            HN = HN << 1;
+            VP = HN | ~(D0 | HP);
+            VN = HP & D0;
+            PrevMask = Mask;
+
+            // Every remaining character lowers the distance at most by one
+            if (Distance > Max + (Text.size() - j - 1)) return Max + 1;
+        }
+        return Distance <= Max ? Distance : Max + 1;
+    }
+
+    /**
+     * @brief Computes optimal string alignment distance between Pattern and Text row by row
+     * @details Fallback of osaDistance(const uint64_t [256], size_t, const StringView &, size_t)
+     * for patterns longer than 64 characters. Stops as soon as a whole row exceeds Max:
+     * later rows can't get below it
+     *
+     * @param[in] Pattern Compared string of any size
+     * @param[in] Text Compared string
+     * @param[in] Max Maximum distance of interest
+     * @return Distance or Max + 1 if it exceeds Max
+     */
+    size_t osaDistance(const StringView &Pattern, const StringView &Text, size_t Max) {
+        const size_t Gap = Pattern.size() > Text.size() ? Pattern.size() - Text.size() : Text.size() - Pattern.size();
+        if (Gap > Max) return Max + 1;
+
+        const size_t Columns = Text.size() + 1;
+        vector<size_t> Rows(3 * Columns);
+        size_t *Older = Rows.data();            ///< Row i - 2
+        size_t *Prev  = Older + Columns;        ///< Row i - 1
+        size_t *Row   = Prev + Columns;         ///< Row i
+        for (size_t j = 0; j < Columns; ++j) Prev[j] = j;
+
+        for (size_t i = 1; i <= Pattern.size(); ++i) {
+            Row[0] = i;
+            size_t RowMin = i;
+            for (size_t j = 1; j < Columns; ++j) {
+                const size_t Substitution = Prev[j - 1] + (Pattern[i - 1] == Text[j - 1] ? 0 : 1);
+                size_t Distance = min(min(Prev[j], Row[j - 1]) + 1, Substitution);
+                if (i > 1 && j > 1 && Pattern[i - 1] == Text[j - 2] && Pattern[i - 2] == Text[j - 1]) {
+                    Distance = min(Distance, Older[j - 2] + 1);
+                }
+                Row[j] = Distance;
+                RowMin = min(RowMin, Distance);
+            }
+            if (RowMin > Max) return Max + 1;
+
+            size_t *Free = Older;
+            Older = Prev;
+            Prev  = Row;
+            Row   = Free;
+        }
+        return Prev[Text.size()] <= Max ? Prev[Text.size()] : Max + 1;
+    }
+
+    /**
+     * @brief Skips spaces and tabs from both ends of [Begin, End)
+     */
+    StringView trim(const char *Begin, const char *End) {
+        while (Begin < End && (*Begin == ' ' || *Begin == '\t')) ++Begin;
+        while (End > Begin && (End[-1] == ' ' || End[-1] == '\t' || End[-1] == '\r')) --End;
+        return StringView(Begin, static_cast<size_t>(End - Begin));
+    }
+
+    /**
+     * @brief Returns Path without directories
+     */
+    string baseName(const char *Path) {
+        const char *Name = Path;
+        for (const char *Ch = Path; *Ch; ++Ch) {
+            if (*Ch == '/' || *Ch == '\\') Name = Ch + 1;
+        }
+        return Name;
+    }
+
+    /**
+     * @brief Builds name of values of Optional for help
+     * @details args::IOptionalArgument::getMetavar() const or the longest flag without indicator
+     * in upper case, e.g. "LOG_LEVEL" for "--log-level"
+     */
+    string metavarOf(const IOptionalArgument &Optional) {
+        if (!Optional.getMetavar().empty()) return Optional.getMetavar();
+
+        const string *Longest = nullptr;
+        for (const string &Flag: Optional.getFlags()) {
+            if (!Longest || Flag.size() > Longest->size()) Longest = &Flag;
+        }
+
+        string Metavar;
+        if (!Longest) return Metavar;
+        for (char Ch: *Longest) {
+            if (isalnum(static_cast<unsigned char>(Ch))) {
+                Metavar += static_cast<char>(toupper(static_cast<unsigned char>(Ch)));
+            } else if (!Metavar.empty()) {
+                Metavar += '_';
+            }
+        }
+        return Metavar;
+    }
+
+    /**
+     * @brief Builds values part of option in help, e.g. " N", " [N]" or " N [N ...]"
+     */
+    string valuesOf(uint32_t NArgs, const string &Metavar) {
+        switch (NArgs) {
+            case NARGS::NO_MORE:
+                return string();
+            case NARGS::ZERO_OR_ONE:
+                return " [" + Metavar + "]";
+            case NARGS::ZERO_AND_MORE:
+                return " [" + Metavar + " ...]";
+            case NARGS::ONE_AND_MORE:
+                return " " + Metavar + " [" + Metavar + " ...]";
+            default: {
+                string Values;
+                for (uint32_t i = 0; i < NArgs; ++i) Values += " " + Metavar;
+                return Values;
+            }
+        }
+    }
+
+    /**
+     * @brief Writes the whole buffer to Fd, normally by one write(2)
+     * @return false in case of write error
+     */
+    bool writeAll(int Fd, const char *Data, size_t Size) {
+        while (Size > 0) {
+#if defined(_WIN32)
+            const int Written = _write(Fd, Data, static_cast<unsigned int>(Size));
+#else
+            const ssize_t Written = write(Fd, Data, Size);
+#endif
+            if (Written < 0) {
+                if (errno == EINTR) continue;
+                return false;
+            }
+            Data += Written;
+            Size -= static_cast<size_t>(Written);
+        }
+        return true;
+    }
+
+    /**
+     * @struct EnvSlot
+     * @brief Slot of environment variables lookup table
+     */
+    struct EnvSlot {
+        uint64_t    Hash;       ///< Hash of variable name
+        const char *Name;       ///< Variable name or nullptr if the slot is free
+        size_t      Size;       ///< Size of variable name
+        uint32_t    Index;      ///< Registration index of argument
+    };
+
+    /**
+     * @brief Builds error message of ArgumentParser::parse(int, const char *[])
+     */
+    string parseError(const ArgparseError &Error) {
+        return string("argparse::ArgumentParser::parse(int, const char *[]): ") + Error.what() + " - " + Error.Arg.toString();
+    }
+
+    /**
+     * @brief Builds error of ArgumentParser::tryParse(int, const char *[], ParseResult &) const
+     */
+    ArgparseError makeError(ErrorCode Code, int Position, const StringView &Arg) {
+        ArgparseError Error;
+        Error.Code     = Code;
+        Error.Position = Position;
+        Error.Arg      = Arg;
+        return Error;
+    }
+
+    /**
+     * @struct ResponseFile
+     * @brief Unread part of a mapped response file
+     */
+    struct ResponseFile {
+        char *Cursor;   ///< First unread character
+        char *End;      ///< End of the mapping
+    };
+
+    /**
+     * @brief Extracts the next argument from response file unquoting it in place
+     * @details Unquoted argument is never longer than the quoted one,
+     * so it is written over the quoted one. Arguments without quotes and escapes
+     * aren't written at all and the mapped pages stay shared
+     *
+     * @param[in,out] File Response file
+     * @param[out] Arg View of extracted argument
+     * @param[out] IsEnd Whether or not the file is over and nothing was extracted
+     * @return ErrorCode::SUCCESS or ErrorCode::RESPONSE_FILE_QUOTE
+     */
+    ErrorCode nextResponseArg(ResponseFile &File, StringView &Arg, bool &IsEnd) {
+        char *Read = File.Cursor;
+        while (Read != File.End && isspace(static_cast<unsigned char>(*Read))) ++Read;
+
+        File.Cursor = Read;
+        IsEnd = Read == File.End;
+        if (IsEnd) return SUCCESS;
+
+        char *const Start = Read;
+        char *Write = Read;
+        char Quote = 0;
+        for (; Read != File.End; ++Read) {
+            char Char = *Read;
+            if (Quote == '\'') {
+                if (Char == '\'') {
+                    Quote = 0;
+                    continue;
+                }
+            } else if (Quote == '"') {
+                if (Char == '"') {
+                    Quote = 0;
+                    continue;
+                }
+                if (Char == '\\' && Read + 1 != File.End && (Read[1] == '"' || Read[1] == '\\')) Char = *++Read;
+            } else {
+                if (isspace(static_cast<unsigned char>(Char))) break;
+                if (Char == '\'' || Char == '"') {
+                    Quote = Char;
+                    continue;
+                }
+                if (Char == '\\' && Read + 1 != File.End) Char = *++Read;
+            }
+
+            if (Write != Read) *Write = Char;
+            ++Write;
+        }
 
+        Arg = StringView(Start, static_cast<size_t>(Write - Start));
+        if (Quote) return RESPONSE_FILE_QUOTE;
+
+        File.Cursor = Read;
+        return SUCCESS;
+    }
+}
 
 
-ArgumentParser::ArgumentParser() {}
 
-ArgumentParser::ArgumentParser(const ArgumentParser &Other) {
+constexpr size_t ArgumentParser::RESPONSE_FILES_DEPTH;
+
+
+
+ArgumentParser::ArgumentParser():
+mStyle(make_shared<UnixStyle>()), mOptionals(), mCopiers(), mFlagIndex(), mShortFlags(), mFlagTrie(), mResult(), mConfigFile(),
+mSubcommands(), mSubcommandIndex(), mProgramName(), mDescription(),
+mPositionals(), mGroups(), mRequiredMask(), mRequiring(), mRequirements(), mImplying(), mImplied(),
+mIsConstraintsCompiled(false), mConstraintsRevision(0), mHelp(), mHelpWidth(0), mHelpRevision(0), mUsageSize(0),
+mIsResponseFilesEnabled(false), mIsAbbreviationsEnabled(false) {
+    mShortFlags.fill(FlagIndex::NOT_FOUND);
+}
+
+ArgumentParser::ArgumentParser(const ArgumentParser &Other):
+mResult(Other.mResult.mArena.getBlockSize()), mIsConstraintsCompiled(false), mConstraintsRevision(0), mHelpWidth(0), mHelpRevision(0), mUsageSize(0),
+mIsResponseFilesEnabled(false), mIsAbbreviationsEnabled(false) {
     selfCopy(Other);
 }
 
-ArgumentParser::ArgumentParser(ArgumentParser &&Other) noexcept {
+ArgumentParser::ArgumentParser(ArgumentParser &&Other) noexcept:
+mResult(move(Other.mResult)), mIsConstraintsCompiled(false), mConstraintsRevision(0), mHelpWidth(0), mHelpRevision(0), mUsageSize(0),
+mIsResponseFilesEnabled(false), mIsAbbreviationsEnabled(false) {
     selfMove(move(Other));
 }
 
 ArgumentParser::~ArgumentParser() noexcept {}
 
+const OptionStyle &ArgumentParser::getOptionStyle() const {
+    return *mStyle;
+}
+
+const ParseResult &ArgumentParser::getResult() const {
+    return mResult;
+}
+
+void ArgumentParser::setArenaBlockSize(size_t BlockSize) {
+    mResult.mArena.setBlockSize(BlockSize);
+}
+
+bool ArgumentParser::isResponseFilesEnabled() const {
+    return mIsResponseFilesEnabled;
+}
+
+void ArgumentParser::setResponseFilesEnabled(bool IsEnabled) {
+    mIsResponseFilesEnabled = IsEnabled;
+}
+
+bool ArgumentParser::isAbbreviationsEnabled() const {
+    return mIsAbbreviationsEnabled;
+}
+
+void ArgumentParser::setAbbreviationsEnabled(bool IsEnabled) {
+    mIsAbbreviationsEnabled = IsEnabled;
+}
+
+const string &ArgumentParser::getProgramName() const {
+    return mProgramName;
+}
+
+void ArgumentParser::setProgramName(const string &Name) {
+    mProgramName = Name;
+    invalidateHelp();
+}
+
+const string &ArgumentParser::getDescription() const {
+    return mDescription;
+}
+
+void ArgumentParser::setDescription(const string &Description) {
+    mDescription = Description;
+    invalidateHelp();
+}
+
+const string &ArgumentParser::getConfigFile() const {
+    return mConfigFile;
+}
+
+void ArgumentParser::setConfigFile(const string &Path) {
+    mConfigFile = Path;
+}
+
+void ArgumentParser::addGroup(GroupKind Kind, const vector<string> &Members) {
+    if (Members.size() < 2) {
+        throw invalid_argument("argparse::ArgumentParser::addGroup(GroupKind, const std::vector<std::string> &): less than 2 members");
+    }
+
+    Group New = {Kind, vector<uint32_t>(), vector<uint64_t>()};
+    New.Members.reserve(Members.size());
+    for (const string &Flag: Members) {
+        const uint32_t Index = indexOf(Flag);
+        if (Index == FlagIndex::NOT_FOUND) {
+            throw invalid_argument(
+                "argparse::ArgumentParser::addGroup(GroupKind, const std::vector<std::string> &): unrecognized option - " + Flag
+            );
+        }
+
+        if (New.Mask.size() <= Index / 64) New.Mask.resize(Index / 64 + 1, 0);
+        New.Mask[Index / 64] |= UINT64_C(1) << (Index % 64);
+        New.Members.push_back(Index);
+    }
+    mGroups.push_back(move(New));
+}
+
+void ArgumentParser::addSubcommand(const string &Name, const SubcommandFactory &Factory, const string &Help) {
+    if (Name.empty()) {
+        throw invalid_argument("argparse::ArgumentParser::addSubcommand(const std::string &, const SubcommandFactory &, const std::string &): empty name");
+    }
+    if (!Factory) {
+        throw invalid_argument(
+            "argparse::ArgumentParser::addSubcommand(const std::string &, const SubcommandFactory &, const std::string &): empty factory - " + Name
+        );
+    }
+    if (mSubcommandIndex.find(Name) != FlagIndex::NOT_FOUND) {
+        throw invalid_argument(
+            "argparse::ArgumentParser::addSubcommand(const std::string &, const SubcommandFactory &, const std::string &): conflicting subcommand - " + Name
+        );
+    }
+
+    Subcommand New = {Name, Help, Factory, nullptr};
+    mSubcommands.push_back(move(New));
+    mSubcommandIndex.insert(Name, static_cast<uint32_t>(mSubcommands.size() - 1));
+    invalidateHelp();
+}
+
+ArgumentParser &ArgumentParser::getSubcommand(const string &Name) {
+    const uint32_t Index = mSubcommandIndex.find(Name);
+    if (Index == FlagIndex::NOT_FOUND) {
+        throw out_of_range("argparse::ArgumentParser::getSubcommand(const std::string &): unknown subcommand - " + Name);
+    }
+    return buildSubcommand(Index);
+}
+
 void ArgumentParser::parse(int argc, const char *argv[]) {
-    list<string> Args;          ///< Args list
+    if (mProgramName.empty() && argc > 0 && argv[0]) setProgramName(baseName(argv[0]));
+    parse(argc, argv, mResult);
+    apply(mResult);
+}
 
-    for (int i = 0; i < argc; ++i) {
-        string Arg = argv[i];   ///< Whole argument
+void ArgumentParser::parse(int argc, const char *argv[], ParseResult &Result) const {
+    const ArgparseError Error = tryParse(argc, argv, Result);
+    const ParseResult *Rejected = &Result;
+    const ArgumentParser &Rejecting = selectedParser(Rejected);
+    if (Error.Code == AMBIGUOUS_OPTION) {
+        string Candidates;
+        for (const string &Flag: Rejecting.getCandidates(Error.Arg)) {
+            Candidates += Candidates.empty() ? " (could be " : ", ";
+            Candidates += Flag;
+        }
+        throw runtime_error(parseError(Error) + Candidates + ")");
+    }
+    if (Error.Code == UNRECOGNIZED_OPTION) {
+        string Suggestions;
+        for (const string &Flag: Rejecting.getSuggestions(Error.Arg)) {
+            Suggestions += Suggestions.empty() ? " (did you mean " : ", ";
+            Suggestions += Flag;
+        }
+        throw runtime_error(parseError(Error) + (Suggestions.empty() ? "" : Suggestions + "?)"));
+    }
+    if (
+        Error.Code == MISSING_REQUIRED_OPTION || Error.Code == EXCLUSIVE_OPTIONS ||
+        Error.Code == MISSING_GROUP_OPTION || Error.Code == MISSING_DEPENDENCY
+    ) {
+        // Every violated constraint at once
+        string Violations;
+        for (const ArgparseError &Violation: Rejecting.getViolations(*Rejected)) {
+            if (!Violations.empty()) Violations += "; ";
+            Violations += Rejecting.describeViolation(Violation);
+        }
+        throw runtime_error("argparse::ArgumentParser::parse(int, const char *[]): " + Violations);
+    }
+    if (Error) {
+        throw runtime_error(parseError(Error));
+    }
+}
 
-        if (Arg[0] == '-') {
-            // Optional argument
-            if (Arg[1] == '-') {
-                //* Long option
+ArgparseError ArgumentParser::tryParse(int argc, const char *argv[]) {
+    if (mProgramName.empty() && argc > 0 && argv[0]) setProgramName(baseName(argv[0]));
+    const ArgparseError Error = tryParse(argc, argv, mResult);
+    if (!Error) apply(mResult);
+    return Error;
+}
 
-            } else {
-                //* Short option
+ArgparseError ArgumentParser::tryParse(int argc, const char *argv[], ParseResult &Result) const {
+    return parseFrom(1, argc, argv, Result);
+}
+
+ArgparseError ArgumentParser::parseFrom(int First, int argc, const char *argv[], ParseResult &Result) const {
+    Result.begin(mOptionals.size());
+
+    uint32_t Pending = FlagIndex::NOT_FOUND;    ///< Index of argument consuming values
+    StringView PendingFlag;                     ///< Flag of pending argument
+    int PendingPosition = 0;                    ///< Position of pending argument flag
+    uint32_t Consumed = 0;                      ///< Number of values consumed by pending argument
+    uint32_t Min = 0, Max = 0;                  ///< Range of values for pending argument
+    bool OptionsEnded = false;                  ///< Whether or not "--" was met
+
+    ResponseFile Files[RESPONSE_FILES_DEPTH];   ///< Stack of response files being read
+    size_t Depth = 0;                           ///< Number of response files being read
+
+    // Classification pass: lengths and kinds of all arguments before binding
+    const size_t Count = argc > First ? static_cast<size_t>(argc - First) : 0;
+    TokenClass *Classes = Result.getArena().allocateArray<TokenClass>(Count);
+    mStyle->classify(argv + First, Count, Classes);
+
+    // Values of positional arguments are distributed after the whole command line is read
+    PositionalValue *Positionals = nullptr;
+    size_t PositionalsCount = 0, PositionalsCapacity = 0;
+    auto addPositional = [&](const StringView &Value, int Position) {
+        if (PositionalsCount == PositionalsCapacity) {
+            // Grows only with arguments of response files
+            PositionalsCapacity = max(Count, PositionalsCapacity * 2);
+            PositionalValue *Grown = Result.getArena().allocateArray<PositionalValue>(PositionalsCapacity);
+            if (PositionalsCount) memcpy(Grown, Positionals, PositionalsCount * sizeof(PositionalValue));
+            Positionals = Grown;
+        }
+        Positionals[PositionalsCount].Value    = Value;
+        Positionals[PositionalsCount].Position = Position;
+        ++PositionalsCount;
+    };
+
+    // Checks that pending argument got enough values
+    auto closePending = [&]() -> bool {
+        const bool IsSatisfied = Pending == FlagIndex::NOT_FOUND || Consumed >= Min;
+        Pending = FlagIndex::NOT_FOUND;
+        return IsSatisfied;
+    };
+
+    uint32_t Selected = FlagIndex::NOT_FOUND;     ///< Index of selected subcommand
+    StringView SelectedName;                    ///< Name of selected subcommand
+    int i = First;
+    while (Selected == FlagIndex::NOT_FOUND) {
+        //* Position of the current argument. Arguments of response files share position of "@path"
+        const int Position = Depth > 0 ? i - 1 : i;
+
+        StringView Arg;
+        bool IsPositional = false;  ///< Whether or not Arg surely isn't an option
+        if (Depth > 0) {
+            bool IsEnd = false;
+            const ErrorCode Code = nextResponseArg(Files[Depth - 1], Arg, IsEnd);
+            if (Code != SUCCESS) return makeError(Code, Position, Arg);
+            if (IsEnd) {
+                --Depth;
+                continue;
             }
+        } else if (i < argc) {
+            const TokenClass &Class = Classes[i - First];
+            Arg = StringView(argv[i], Class.Length);
+            IsPositional = Class.Kind == POSITIONAL;
+            ++i;
+        } else {
+            break;
+        }
+
+        if (OptionsEnded) {
+            //* "@path" after "--" is a literal value too
+            if (mPositionals.empty()) return makeError(UNRECOGNIZED_ARGUMENT, Position, Arg);
+            addPositional(Arg, Position);
+            continue;
+        }
 
+        if (mIsResponseFilesEnabled && Arg.size() > 1 && Arg[0] == '@') {
+            //* Response file: its arguments are read before the rest
+            if (Depth == RESPONSE_FILES_DEPTH) {
+                return makeError(RESPONSE_FILE_DEPTH, Position, Arg);
+            }
+
+            MappedFile *File = Result.mapFile(Arg.substr(1).toString());
+            if (!File) {
+                return makeError(RESPONSE_FILE_UNREADABLE, Position, Arg);
+            }
+
+            Files[Depth].Cursor = File->data();
+            Files[Depth].End    = File->data() + File->size();
+            ++Depth;
+            continue;
+        }
+
+        Token Tok;
+        if (IsPositional) {
+            Tok.Value = Arg;
         } else {
-            // Positional argument
+            const ErrorCode Code = mStyle->tryTokenize(Arg, Tok);
+            if (Code != SUCCESS) return makeError(Code, Position, Arg);
+
+            if (
+                Tok.Kind != POSITIONAL && Tok.Kind != TERMINATOR &&
+                isNegativeNumber(Arg) && indexOf(Tok.Flag) == FlagIndex::NOT_FOUND
+            ) {
+                Tok = Token();
+                Tok.Value = Arg;
+            }
+        }
+
+        switch (Tok.Kind) {
+            case POSITIONAL:
+                if (Pending != FlagIndex::NOT_FOUND && Consumed < Max) {
+                    //* Value of pending argument
+                    const ErrorCode Code = bindValue(Pending, Tok.Value, Result);
+                    if (Code != SUCCESS) return makeError(Code, Position, Tok.Value);
+                    ++Consumed;
+                    break;
+                }
+                if (!closePending()) {
+                    return makeError(EXPECTED_MORE_VALUES, PendingPosition, PendingFlag);
+                }
+
+                if (Depth == 0 && !mSubcommands.empty()) {
+                    //* Subcommand takes the rest of argv
+                    Selected     = mSubcommandIndex.find(Arg);
+                    SelectedName = Arg;
+                    if (Selected != FlagIndex::NOT_FOUND) break;
+                }
+
+                if (mPositionals.empty()) return makeError(UNRECOGNIZED_ARGUMENT, Position, Arg);
+                addPositional(Tok.Value, Position);
+                break;
+
+            case TERMINATOR:
+                if (!closePending()) {
+                    return makeError(EXPECTED_MORE_VALUES, PendingPosition, PendingFlag);
+                }
+                OptionsEnded = true;
+                break;
+
+            default: {
+                //* Option
+                if (!closePending()) {
+                    return makeError(EXPECTED_MORE_VALUES, PendingPosition, PendingFlag);
+                }
+
+                const bool IsShort = Tok.Kind == SHORT_OPTION && Tok.Option.size() == 1;
+                uint32_t Index = IsShort ? shortIndexOf(Tok.Option[0]) : indexOf(Tok.Flag);
+                if (Index == FlagIndex::NOT_FOUND && mIsAbbreviationsEnabled && !IsShort) {
+                    Index = mFlagTrie.find(Tok.Flag);
+                    if (Index == FlagTrie::AMBIGUOUS) {
+                        return makeError(AMBIGUOUS_OPTION, Position, Tok.Flag);
+                    }
+                }
+                if (Index == FlagIndex::NOT_FOUND) {
+                    return makeError(UNRECOGNIZED_OPTION, Position, Tok.Flag);
+                }
+
+                getValuesRange(mOptionals[Index]->getNArgs(), Min, Max);
+                Pending         = Index;
+                PendingFlag     = Tok.Flag;
+                PendingPosition = Position;
+                Consumed        = 0;
+
+                Result.addOccurrence(Index);
+                if (!Tok.HasValue) break;
+
+                if (Max > 0) {
+                    const ErrorCode Code = bindValue(Index, Tok.Value, Result);
+                    if (Code != SUCCESS) return makeError(Code, Position, Tok.Value);
+                    ++Consumed;
+                    break;
+                }
+                if (!IsShort) {
+                    return makeError(UNEXPECTED_VALUE, Position, Tok.Flag);
+                }
+
+                //* Cluster "-xvzf": characters are options until one accepting values
+                for (size_t c = 0; c < Tok.Value.size(); ++c) {
+                    const uint32_t Next = shortIndexOf(Tok.Value[c]);
+                    if (Next == FlagIndex::NOT_FOUND) {
+                        return makeError(UNRECOGNIZED_OPTION, Position, Arg);
+                    }
+
+                    getValuesRange(mOptionals[Next]->getNArgs(), Min, Max);
+                    Pending     = Next;
+                    PendingFlag = Arg;
+
+                    Result.addOccurrence(Next);
+                    if (Max > 0) {
+                        // The rest of the cluster is the value
+                        if (c + 1 < Tok.Value.size()) {
+                            const StringView Value = Tok.Value.substr(c + 1);
+                            const ErrorCode Code = bindValue(Next, Value, Result);
+                            if (Code != SUCCESS) return makeError(Code, Position, Value);
+                            ++Consumed;
+                        }
+                        break;
+                    }
+                }
+                break;
+            }
+        }
+    }
+
+    if (!closePending()) {
+        return makeError(EXPECTED_MORE_VALUES, PendingPosition, PendingFlag);
+    }
+
+    if (!mPositionals.empty()) {
+        const ArgparseError Error = distributePositionals(Positionals, PositionalsCount, Result);
+        if (Error) return Error;
+    }
+
+    {
+        const ArgparseError Error = readEnvironment(Result);
+        if (Error) return Error;
+    }
+    if (!mConfigFile.empty()) {
+        const ArgparseError Error = readConfig(Result);
+        if (Error) return Error;
+    }
+
+    compileConstraints();
+    applyImplications(Result);
+    const ArgparseError Error = checkConstraints(Result, nullptr);
+    if (Error) return Error;
+
+    if (Selected != FlagIndex::NOT_FOUND) {
+        ParseResult &Nested = Result.selectSubcommand(Selected, SelectedName);
+        return buildSubcommand(Selected).parseFrom(i, argc, argv, Nested);
+    }
+    return ArgparseError();
+}
+
+ArgparseError ArgumentParser::readEnvironment(ParseResult &Result) const {
+    size_t Count = 0;
+    for (uint32_t i = 0; i < mOptionals.size(); ++i) {
+        if (!mOptionals[i]->getEnvVar().empty() && Result.getCount(i) == 0) ++Count;
+    }
+    if (Count == 0) return ArgparseError();
+
+    // Open addressing with linear probing, load factor is at most 0.5
+    size_t SlotsCount = 4;
+    while (SlotsCount < Count * 2) SlotsCount <<= 1;
+    const size_t Mask = SlotsCount - 1;
+
+    EnvSlot *Slots = Result.getArena().allocateArray<EnvSlot>(SlotsCount);
+    // Free slots have no name and zero size, slots of found variables keep their size
+    for (size_t s = 0; s < SlotsCount; ++s) Slots[s] = {0, nullptr, 0, 0};
+
+    for (uint32_t i = 0; i < mOptionals.size(); ++i) {
+        const string &Name = mOptionals[i]->getEnvVar();
+        if (Name.empty() || Result.getCount(i) != 0) continue;
+
+        const uint64_t Hash = FlagIndex::hash(Name);
+        size_t s = static_cast<size_t>(Hash) & Mask;
+        while (Slots[s].Name) s = (s + 1) & Mask;
+        Slots[s] = {Hash, Name.data(), Name.size(), i};
+    }
+
+    //* Single scan of the environment. Found slots are freed, so the first definition wins
+    for (char **Entry = ARGPARSE_ENVIRON; Entry && *Entry; ++Entry) {
+        const char *Separator = strchr(*Entry, '=');
+        if (!Separator || Separator == *Entry) continue;
+
+        const StringView Name(*Entry, static_cast<size_t>(Separator - *Entry));
+        const uint64_t Hash = FlagIndex::hash(Name);
+        for (size_t s = static_cast<size_t>(Hash) & Mask; Slots[s].Name || Slots[s].Size; s = (s + 1) & Mask) {
+            EnvSlot &Slot = Slots[s];
+            if (
+                !Slot.Name || Slot.Hash != Hash || Slot.Size != Name.size() ||
+                memcmp(Slot.Name, Name.data(), Name.size()) != 0
+            ) continue;
+
+            // Arguments with variables accept values, see IArgument::setEnvVar(const std::string &)
+            Result.addOccurrence(Slot.Index);
+            const ErrorCode Code = bindValue(Slot.Index, StringView(Separator + 1), Result);
+            if (Code != SUCCESS) return makeError(Code, 0, StringView(*Entry));
+            Slot.Name = nullptr;
+            break;
+        }
+    }
+    return ArgparseError();
+}
+
+uint32_t ArgumentParser::indexOf(const StringView &Flag) const {
+    return mFlagIndex.find(Flag);
+}
+
+vector<string> ArgumentParser::getSuggestions(const StringView &Flag, size_t MaxDistance) const {
+    vector<string> Suggestions;
+    if (Flag.empty()) return Suggestions;
+
+    // Bit vectors hold patterns of at most 64 characters
+    const bool IsLong = Flag.size() > 64;
+    uint64_t Masks[256] = {};
+    for (size_t i = 0; i < Flag.size() && !IsLong; ++i) {
+        Masks[static_cast<unsigned char>(Flag[i])] |= UINT64_C(1) << i;
+    }
+
+    size_t Best = MaxDistance;
+    for (const shared_ptr<IOptionalArgument> &Optional: mOptionals) {
+        for (const string &Candidate: Optional->getFlags()) {
+            if (isPositionalFlag(Candidate)) continue;
+            const size_t Distance = IsLong ? osaDistance(Flag, Candidate, Best) : osaDistance(Masks, Flag.size(), Candidate, Best);
+            if (Distance > Best) continue;
+
+            if (Distance < Best) {
+                Best = Distance;
+                Suggestions.clear();
+            }
+            Suggestions.push_back(Candidate);
+        }
+    }
+    return Suggestions;
+}
+
+vector<string> ArgumentParser::getCandidates(const StringView &Prefix) const {
+    vector<string> Candidates;
+    for (const shared_ptr<IOptionalArgument> &Optional: mOptionals) {
+        for (const string &Flag: Optional->getFlags()) {
+            if (StringView(Flag).startsWith(Prefix)) Candidates.push_back(Flag);
+        }
+    }
+    return Candidates;
+}
+
+uint32_t ArgumentParser::shortIndexOf(char Option) const {
+    return mShortFlags[static_cast<unsigned char>(Option)];
+}
+
+CompiledParser ArgumentParser::compile() const {
+    return CompiledParser(*this);
+}
+
+void ArgumentParser::registerArgument(const shared_ptr<IOptionalArgument> &Argument, ArgumentCopier Copier) {
+    const Flags &ArgFlags = Argument->getFlags();
+
+    const bool IsPositional = !ArgFlags.empty() && isPositionalFlag(ArgFlags.front());
+    if (IsPositional && ArgFlags.size() > 1) {
+        throw invalid_argument(
+            "argparse::ArgumentParser::addArgument(Arg &&): positional argument with several flags - " + ArgFlags.front()
+        );
+    }
+    if (IsPositional && Argument->getNArgs() == NARGS::NO_MORE) {
+        throw invalid_argument(
+            "argparse::ArgumentParser::addArgument(Arg &&): positional argument doesn't consume values - " + ArgFlags.front()
+        );
+    }
+
+    // Check all flags first to leave the index untouched on conflicts
+    for (Flags::const_iterator It = ArgFlags.begin(); It != ArgFlags.end(); ++It) {
+        bool Conflicts = mFlagIndex.find(*It) != FlagIndex::NOT_FOUND;
+        for (Flags::const_iterator Prev = ArgFlags.begin(); !Conflicts && Prev != It; ++Prev) {
+            Conflicts = *Prev == *It;
+        }
+
+        if (Conflicts) {
+            throw invalid_argument(
+                string("argparse::ArgumentParser::addArgument(Arg &&): conflicting flag - ") + *It
+            );
+        }
+    }
+
+    const uint32_t Index = static_cast<uint32_t>(mOptionals.size());
+    // Both vectors grow beforehand: pushing can't leave them of different sizes
+    if (mOptionals.size() == mOptionals.capacity() || mCopiers.size() == mCopiers.capacity()) {
+        mOptionals.reserve(2 * mOptionals.size() + 1);
+        mCopiers.reserve(2 * mOptionals.size() + 1);
+    }
+    mOptionals.push_back(Argument);
+    mCopiers.push_back(Copier);
+    if (IsPositional) {
+        // Name is indexed for rules and groups only: it is never matched on the command line
+        mPositionals.push_back(Index);
+        mFlagIndex.insert(ArgFlags.front(), Index);
+        mIsConstraintsCompiled = false;
+        invalidateHelp();
+        return;
+    }
+    for (const string &Flag: ArgFlags) {
+        mFlagIndex.insert(Flag, Index);
+        mFlagTrie.insert(Flag, Index);
+        // Short options ("-c") are the only ones which can be clustered
+        if (Flag.size() == 2 && Flag[0] == '-' && Flag[1] != '-') {
+            mShortFlags[static_cast<unsigned char>(Flag[1])] = Index;
+        }
+    }
+    mIsConstraintsCompiled = false;
+    invalidateHelp();
+}
+
+bool ArgumentParser::isPositionalFlag(const string &Flag) const {
+    Token Tok;
+    return mStyle->tryTokenize(Flag, Tok) == SUCCESS && Tok.Kind == POSITIONAL;
+}
+
+ErrorCode ArgumentParser::bindValue(uint32_t Index, const StringView &Value, ParseResult &Result) const {
+    const ErrorCode Code = mOptionals[Index]->validateValue(Value);
+    if (Code == SUCCESS) Result.addValue(Index, Value);
+    return Code;
+}
+
+ArgparseError ArgumentParser::distributePositionals(const PositionalValue *Values, size_t Count, ParseResult &Result) const {
+    uint32_t Min = 0, Max = 0;
+    size_t MinLeft = 0;     ///< Minimum number of values of the next arguments
+    for (uint32_t Index: mPositionals) {
+        getValuesRange(mOptionals[Index]->getNArgs(), Min, Max);
+        MinLeft += Min;
+    }
+
+    size_t Used = 0;
+    for (uint32_t Index: mPositionals) {
+        getValuesRange(mOptionals[Index]->getNArgs(), Min, Max);
+        MinLeft -= Min;
+
+        // Greedy: as many values as possible, but not the ones needed by the next arguments
+        const size_t Left = Count - Used;
+        const size_t Taken = Left >= MinLeft + Min ? min<size_t>(Max, Left - MinLeft) : min<size_t>(Min, Left);
+        if (Taken == 0) continue;
+        if (Taken < Min) return makeError(EXPECTED_MORE_VALUES, Values[Count - 1].Position, flagOf(Index));
+
+        Result.addOccurrence(Index);
+        for (const size_t End = Used + Taken; Used < End; ++Used) {
+            const ErrorCode Code = bindValue(Index, Values[Used].Value, Result);
+            if (Code != SUCCESS) return makeError(Code, Values[Used].Position, Values[Used].Value);
         }
     }
+
+    if (Used < Count) return makeError(UNRECOGNIZED_ARGUMENT, Values[Used].Position, Values[Used].Value);
+    return ArgparseError();
 }
 
-void ArgumentParser::splitOption(
-    const string &Arg,
-    string &Option,
-    string &Value
-) const {
-    size_t ValueDelimPos = Arg.find_first_of("=:");
-    if (ValueDelimPos != string::npos) {
-        Value = Arg.substr(ValueDelimPos + 1);
+void ArgumentParser::apply(const ParseResult &Result) const {
+    for (size_t i = 0; i < mOptionals.size() && i < Result.mSize; ++i) {
+        IOptionalArgument &Optional = *mOptionals[i];
+
+        Optional.applyDefault();
+        if (Result.mSlots[i].ValuesCount) Optional.reserveValues(Result.mSlots[i].ValuesCount);
+        for (const ParseResult::Event *Ev = Result.mSlots[i].First; Ev; Ev = Ev->Next) {
+            if (Ev->IsValue) {
+                Optional.applyValue(Ev->Value);
+            } else {
+                Optional.applyFlag();
+            }
+        }
+    }
+
+    if (Result.mSubcommand < mSubcommands.size()) {
+        mSubcommands[Result.mSubcommand].Parser->apply(*Result.mSubcommandResult);
     }
-    Option = Arg.substr(0, ValueDelimPos);
 }
 
-void ArgumentParser::selfCopy(const ArgumentParser &Other) {}
+ArgumentParser &ArgumentParser::buildSubcommand(uint32_t Index) const {
+    Subcommand &Command = mSubcommands[Index];
+    if (Command.Parser) return *Command.Parser;
+
+    shared_ptr<ArgumentParser> Parser = make_shared<ArgumentParser>();
+    Parser->mStyle = mStyle;
+    Parser->mProgramName = mProgramName + " " + Command.Name;
+    Parser->mDescription = Command.Help;
+    Parser->mIsResponseFilesEnabled = mIsResponseFilesEnabled;
+    Parser->mIsAbbreviationsEnabled = mIsAbbreviationsEnabled;
+    Command.Factory(*Parser);
+
+    Command.Parser = move(Parser);
+    return *Command.Parser;
+}
+
+const ArgumentParser &ArgumentParser::selectedParser(const ParseResult *&Result) const {
+    const uint32_t Selected = Result->mSubcommand;
+    if (Selected < mSubcommands.size() && mSubcommands[Selected].Parser) {
+        Result = Result->mSubcommandResult.get();
+        return mSubcommands[Selected].Parser->selectedParser(Result);
+    }
+    return *this;
+}
+
+ArgparseError ArgumentParser::readConfig(ParseResult &Result) const {
+    // Read by every parse: results own their views and compiled parsers stay immutable
+    MappedFile *File = Result.mapFile(mConfigFile);
+    if (!File) {
+        if (MappedFile::isMissing(mConfigFile)) return ArgparseError();
+        return makeError(CONFIG_FILE_UNREADABLE, 0, StringView(mConfigFile.data(), mConfigFile.size()));
+    }
+
+    // Arguments given on the command line or in the environment ignore the file
+    bool *IsOverridden = Result.getArena().allocateArray<bool>(mOptionals.size());
+    for (uint32_t i = 0; i < mOptionals.size(); ++i) IsOverridden[i] = Result.getCount(i) != 0;
+
+    const StringView Indicator(mStyle->getIndicator());
+    StringView Section;
+    char  *Flag = nullptr;      ///< Buffer of flag reused by keys which fit it
+    size_t FlagCapacity = 0;    ///< Size of the buffer
+
+    const char *Cursor = File->data();
+    const char *End    = Cursor + File->size();
+    for (int Line = 1; Cursor < End; ++Line) {
+        const char *LineEnd = static_cast<const char *>(memchr(Cursor, '\n', static_cast<size_t>(End - Cursor)));
+        if (!LineEnd) LineEnd = End;
+        const StringView Text = trim(Cursor, LineEnd);
+        Cursor = LineEnd + 1;
+
+        if (Text.empty() || Text[0] == '#' || Text[0] == ';') continue;
+
+        if (Text[0] == '[') {
+            //* Section
+            if (Text[Text.size() - 1] != ']') return makeError(CONFIG_FILE_SYNTAX, Line, Text);
+            Section = trim(Text.data() + 1, Text.data() + Text.size() - 1);
+            continue;
+        }
+
+        //* "key = value" or "key"
+        const size_t Separator = Text.find('=');
+        const bool HasValue = Separator != StringView::npos;
+        const StringView Key = HasValue ? trim(Text.data(), Text.data() + Separator) : Text;
+        if (Key.empty()) return makeError(CONFIG_FILE_SYNTAX, Line, Text);
+
+        // Flag is "<indicator>[section.]key"
+        const size_t FlagSize = Indicator.size() + (Section.empty() ? 0 : Section.size() + 1) + Key.size();
+        if (FlagSize > FlagCapacity) {
+            FlagCapacity = FlagSize * 2;
+            Flag = Result.getArena().allocateArray<char>(FlagCapacity);
+        }
+        char *Out = Flag;
+        memcpy(Out, Indicator.data(), Indicator.size());
+        Out += Indicator.size();
+        if (!Section.empty()) {
+            memcpy(Out, Section.data(), Section.size());
+            Out += Section.size();
+            *Out++ = '.';
+        }
+        memcpy(Out, Key.data(), Key.size());
+
+        const uint32_t Index = indexOf(StringView(Flag, FlagSize));
+        if (Index == FlagIndex::NOT_FOUND) return makeError(UNRECOGNIZED_CONFIG_KEY, Line, Key);
+        if (IsOverridden[Index]) continue;
+
+        uint32_t Min = 0, Max = 0;
+        getValuesRange(mOptionals[Index]->getNArgs(), Min, Max);
+        if (HasValue && Max == 0) return makeError(UNEXPECTED_VALUE, Line, Key);
+        if (!HasValue && Min > 0) return makeError(EXPECTED_MORE_VALUES, Line, Key);
+
+        Result.addOccurrence(Index);
+        if (!HasValue) continue;
+
+        StringView Value = trim(Text.data() + Separator + 1, Text.data() + Text.size());
+        if (Value.size() >= 2 && (Value[0] == '"' || Value[0] == '\'') && Value[Value.size() - 1] == Value[0]) {
+            Value = Value.substr(1, Value.size() - 2);
+        }
+        const ErrorCode Code = bindValue(Index, Value, Result);
+        if (Code != SUCCESS) return makeError(Code, Line, Value);
+    }
+    return ArgparseError();
+}
+
+void ArgumentParser::compileConstraints() const {
+    // Arguments may be changed through references after registration
+    const uint64_t Revision = getArgumentsRevision();
+    if (mIsConstraintsCompiled && mConstraintsRevision == Revision) return;
+
+    const size_t Count = mOptionals.size();
+    const size_t Words = (Count + 63) / 64;
+    mRequiredMask.assign(Words, 0);
+    mRequiring.clear();
+    mRequirements.clear();
+    mImplying.clear();
+    mImplied.clear();
 
-void ArgumentParser::selfMove(ArgumentParser &&Other) noexcept {}
+    auto resolve = [this](uint32_t From, const string &Flag) -> uint32_t {
+        const uint32_t To = indexOf(Flag);
+        if (To == FlagIndex::NOT_FOUND) {
+            throw invalid_argument(
+                "argparse::ArgumentParser::compileConstraints(): unrecognized option in rule of " +
+                flagOf(From).toString() + " - " + Flag
+            );
+        }
+        return To;
+    };
+
+    vector<vector<uint32_t>> Implications(Count);
+    for (uint32_t i = 0; i < Count; ++i) {
+        const IOptionalArgument &Optional = *mOptionals[i];
+        if (Optional.isRequired()) mRequiredMask[i / 64] |= UINT64_C(1) << (i % 64);
+
+        if (!Optional.getRequires().empty()) {
+            //* Rules: mask of every argument required by this one
+            const size_t Base = mRequirements.size();
+            mRequiring.push_back(i);
+            mRequirements.resize(Base + Words, 0);
+            for (const string &Flag: Optional.getRequires()) {
+                const uint32_t To = resolve(i, Flag);
+                mRequirements[Base + To / 64] |= UINT64_C(1) << (To % 64);
+            }
+        }
+        for (const string &Flag: Optional.getImplies()) Implications[i].push_back(resolve(i, Flag));
+    }
+    for (uint32_t Index: mPositionals) {
+        uint32_t Min = 0, Max = 0;
+        getValuesRange(mOptionals[Index]->getNArgs(), Min, Max);
+        if (Min > 0) mRequiredMask[Index / 64] |= UINT64_C(1) << (Index % 64);
+    }
+
+    //* Implications: transitive closure of every implying argument
+    vector<uint32_t> Stack;
+    for (uint32_t i = 0; i < Count; ++i) {
+        if (Implications[i].empty()) continue;
+
+        const size_t Base = mImplied.size();
+        mImplying.push_back(i);
+        mImplied.resize(Base + Words, 0);
+
+        Stack = Implications[i];
+        while (!Stack.empty()) {
+            const uint32_t Next = Stack.back();
+            Stack.pop_back();
+
+            uint64_t &Word = mImplied[Base + Next / 64];
+            const uint64_t Bit = UINT64_C(1) << (Next % 64);
+            if (Word & Bit) continue;
+            Word |= Bit;
+            Stack.insert(Stack.end(), Implications[Next].begin(), Implications[Next].end());
+        }
+    }
+
+    mIsConstraintsCompiled = true;
+    mConstraintsRevision   = Revision;
+}
+
+void ArgumentParser::applyImplications(ParseResult &Result) const {
+    const size_t Words = Result.mSeenWords;
+    for (size_t k = 0; k < mImplying.size(); ++k) {
+        const uint32_t Index = mImplying[k];
+        if (!(Result.mSeen[Index / 64] & (UINT64_C(1) << (Index % 64)))) continue;
+
+        const uint64_t *Closure = mImplied.data() + k * Words;
+        for (size_t w = 0; w < Words; ++w) {
+            uint64_t New = Closure[w] & ~Result.mSeen[w];
+            for (; New; New &= New - 1) Result.addOccurrence(w * 64 + lowestBit(New));
+        }
+    }
+}
+
+ArgparseError ArgumentParser::checkConstraints(const ParseResult &Result, vector<ArgparseError> *Violations) const {
+    const uint64_t *Seen = Result.mSeen;
+    auto isSeen = [Seen](uint32_t Index) {
+        return (Seen[Index / 64] & (UINT64_C(1) << (Index % 64))) != 0;
+    };
+
+    // Keeps the first violation, returns true if checking should stop
+    ArgparseError First;
+    auto report = [&First, Violations](const ArgparseError &Error) {
+        if (!First) First = Error;
+        if (Violations) Violations->push_back(Error);
+        return Violations == nullptr;
+    };
+
+    for (size_t w = 0; w < mRequiredMask.size(); ++w) {
+        for (uint64_t Missing = mRequiredMask[w] & ~Seen[w]; Missing; Missing &= Missing - 1) {
+            const uint32_t Index = static_cast<uint32_t>(w * 64 + lowestBit(Missing));
+            if (report(makeError(MISSING_REQUIRED_OPTION, 0, flagOf(Index)))) return First;
+        }
+    }
+
+    for (size_t g = 0; g < mGroups.size(); ++g) {
+        const Group &Current = mGroups[g];
+
+        // Only the first two seen members matter
+        uint32_t FirstSeen = FlagIndex::NOT_FOUND, SecondSeen = FlagIndex::NOT_FOUND;
+        for (size_t w = 0; w < Current.Mask.size() && SecondSeen == FlagIndex::NOT_FOUND; ++w) {
+            uint64_t Hits = Current.Mask[w] & Seen[w];
+            if (Hits && FirstSeen == FlagIndex::NOT_FOUND) {
+                FirstSeen = static_cast<uint32_t>(w * 64 + lowestBit(Hits));
+                Hits &= Hits - 1;
+            }
+            if (Hits) SecondSeen = static_cast<uint32_t>(w * 64 + lowestBit(Hits));
+        }
+
+        if (Current.Kind != AT_LEAST_ONE && SecondSeen != FlagIndex::NOT_FOUND) {
+            if (report(makeError(EXCLUSIVE_OPTIONS, static_cast<int>(g), flagOf(SecondSeen)))) return First;
+        }
+        if (Current.Kind != MUTUALLY_EXCLUSIVE && FirstSeen == FlagIndex::NOT_FOUND) {
+            if (report(makeError(MISSING_GROUP_OPTION, static_cast<int>(g), flagOf(Current.Members.front())))) return First;
+        }
+    }
+
+    //* Rules: arguments required by a seen argument and not seen themselves, one word of arguments at a time
+    const size_t Words = Result.mSeenWords;
+    for (size_t k = 0; k < mRequiring.size(); ++k) {
+        const uint32_t Index = mRequiring[k];
+        if (!isSeen(Index)) continue;
+
+        const uint64_t *Required = mRequirements.data() + k * Words;
+        for (size_t w = 0; w < Words; ++w) {
+            for (uint64_t Missing = Required[w] & ~Seen[w]; Missing; Missing &= Missing - 1) {
+                const uint32_t To = static_cast<uint32_t>(w * 64 + lowestBit(Missing));
+                if (report(makeError(MISSING_DEPENDENCY, static_cast<int>(To), flagOf(Index)))) return First;
+            }
+        }
+    }
+    return First;
+}
+
+vector<ArgparseError> ArgumentParser::getViolations(const ParseResult &Result) const {
+    if (Result.mSize != mOptionals.size()) {
+        throw invalid_argument("argparse::ArgumentParser::getViolations(const ParseResult &): result of another parser");
+    }
+
+    compileConstraints();
+    vector<ArgparseError> Violations;
+    checkConstraints(Result, &Violations);
+    return Violations;
+}
+
+string ArgumentParser::describeViolation(const ArgparseError &Violation) const {
+    string Description = string(Violation.what()) + " - " + Violation.Arg.toString();
+    switch (Violation.Code) {
+        case EXCLUSIVE_OPTIONS:
+        case MISSING_GROUP_OPTION: {
+            const char *Separator = " (group: ";
+            for (uint32_t Index: mGroups[static_cast<size_t>(Violation.Position)].Members) {
+                Description += Separator + flagOf(Index).toString();
+                Separator = ", ";
+            }
+            Description += ")";
+            break;
+        }
+        case MISSING_DEPENDENCY:
+            Description += " (requires " + flagOf(static_cast<uint32_t>(Violation.Position)).toString() + ")";
+            break;
+        default:
+            break;
+    }
+    return Description;
+}
+
+StringView ArgumentParser::flagOf(uint32_t Index) const {
+    const Flags &ArgFlags = mOptionals[Index]->getFlags();
+    return ArgFlags.empty() ? StringView() : StringView(ArgFlags.front());
+}
+
+const string &ArgumentParser::formatHelp(size_t Width) const {
+    const size_t Resolved = max(Width, HelpFormatter::MIN_WIDTH);
+    const uint64_t Revision = getArgumentsRevision();
+    if (mHelpWidth == Resolved && mHelpRevision == Revision) return mHelp;
+
+    vector<string> Usage;       ///< Items of usage line
+    vector<string> Lefts;       ///< Left columns of entries
+    vector<string> Helps;       ///< Help of entries
+    Usage.reserve(mOptionals.size() + 1);
+    Lefts.reserve(mOptionals.size());
+    Helps.reserve(mOptionals.size());
+
+    vector<bool> IsPositional(mOptionals.size(), false);
+    for (uint32_t Index: mPositionals) IsPositional[Index] = true;
+
+    for (size_t i = 0; i < mOptionals.size(); ++i) {
+        const IOptionalArgument *Optional = mOptionals[i].get();
+        const Flags &ArgFlags = Optional->getFlags();
+
+        if (IsPositional[i]) {
+            // Values only, e.g. "files [files ...]"
+            const string Values = valuesOf(
+                Optional->getNArgs(), Optional->getMetavar().empty() ? ArgFlags.front() : Optional->getMetavar()
+            ).substr(1);
+            Lefts.push_back(Values);
+        } else {
+            const string Values = valuesOf(Optional->getNArgs(), metavarOf(*Optional));
+
+            string Left;
+            for (const string &Flag: ArgFlags) {
+                if (!Left.empty()) Left += ", ";
+                Left += Flag;
+            }
+            Lefts.push_back(Left + Values);
+
+            const string Item = (ArgFlags.empty() ? string() : ArgFlags.front()) + Values;
+            Usage.push_back(Optional->isRequired() ? Item : "[" + Item + "]");
+        }
+
+        string Help = Optional->getHelp();
+        if (Optional->isDeprecated()) Help += Help.empty() ? "(deprecated)" : " (deprecated)";
+        if (!Optional->getEnvVar().empty()) Help += (Help.empty() ? "[env: " : " [env: ") + Optional->getEnvVar() + "]";
+        Helps.push_back(move(Help));
+    }
+
+    for (uint32_t Index: mPositionals) Usage.push_back(Lefts[Index]);
+
+    if (!mSubcommands.empty()) {
+        string Names = "{";
+        for (const Subcommand &Command: mSubcommands) {
+            if (Names.size() > 1) Names += ',';
+            Names += Command.Name;
+        }
+        Usage.push_back(Names + "} ...");
+    }
+
+    HelpFormatter Formatter(Resolved);
+    Formatter.addUsage(mProgramName, Usage);
+    if (!mDescription.empty()) Formatter.addText(mDescription);
+    if (!mPositionals.empty()) {
+        Formatter.addSection("positional arguments:");
+        for (uint32_t Index: mPositionals) Formatter.addEntry(Lefts[Index], Helps[Index]);
+    }
+    if (mOptionals.size() > mPositionals.size()) {
+        Formatter.addSection("options:");
+        for (size_t i = 0; i < mOptionals.size(); ++i) {
+            if (!IsPositional[i]) Formatter.addEntry(Lefts[i], Helps[i]);
+        }
+    }
+    if (!mSubcommands.empty()) {
+        Formatter.addSection("subcommands:");
+        for (const Subcommand &Command: mSubcommands) Formatter.addEntry(Command.Name, Command.Help);
+    }
+
+    mHelp.clear();
+    Formatter.render(mHelp);
+    // Usage is everything before the first empty line
+    const size_t Blank = mHelp.find("\n\n");
+    mUsageSize = Blank == string::npos ? mHelp.size() : Blank + 1;
+    mHelpWidth    = Resolved;
+    mHelpRevision = Revision;
+    return mHelp;
+}
+
+bool ArgumentParser::printHelp(int Fd) const {
+    const string &Help = formatHelp(HelpFormatter::getTerminalWidth(Fd));
+    return writeAll(Fd, Help.data(), Help.size());
+}
+
+bool ArgumentParser::printUsage(int Fd) const {
+    const string &Help = formatHelp(HelpFormatter::getTerminalWidth(Fd));
+    return writeAll(Fd, Help.data(), mUsageSize);
+}
+
+uint64_t ArgumentParser::getArgumentsRevision() const {
+    uint64_t Revision = 0;
+    for (const shared_ptr<IOptionalArgument> &Optional: mOptionals) Revision += Optional->getRevision();
+    return Revision;
+}
+
+void ArgumentParser::invalidateHelp() {
+    mHelpWidth = 0;
+}
+
+void ArgumentParser::selfCopy(const ArgumentParser &Other) {
+    mStyle      = Other.mStyle;
+    mOptionals  = Other.mOptionals;
+    mCopiers    = Other.mCopiers;
+    mFlagIndex  = Other.mFlagIndex;
+    mShortFlags = Other.mShortFlags;
+    mFlagTrie   = Other.mFlagTrie;
+    mConfigFile = Other.mConfigFile;
+    mSubcommands     = Other.mSubcommands;
+    mSubcommandIndex = Other.mSubcommandIndex;
+    mProgramName     = Other.mProgramName;
+    mDescription     = Other.mDescription;
+    mPositionals     = Other.mPositionals;
+    mGroups          = Other.mGroups;
+    mIsConstraintsCompiled = false;
+    invalidateHelp();
+    mIsResponseFilesEnabled = Other.mIsResponseFilesEnabled;
+    mIsAbbreviationsEnabled = Other.mIsAbbreviationsEnabled;
+}
+
+void ArgumentParser::selfMove(ArgumentParser &&Other) noexcept {
+    mStyle      = move(Other.mStyle);
+    mOptionals  = move(Other.mOptionals);
+    mCopiers    = move(Other.mCopiers);
+    mFlagIndex  = move(Other.mFlagIndex);
+    mShortFlags = Other.mShortFlags;
+    mFlagTrie   = move(Other.mFlagTrie);
+    mConfigFile = move(Other.mConfigFile);
+    mSubcommands     = move(Other.mSubcommands);
+    mSubcommandIndex = move(Other.mSubcommandIndex);
+    mProgramName     = move(Other.mProgramName);
+    mDescription     = move(Other.mDescription);
+    mPositionals     = move(Other.mPositionals);
+    mGroups          = move(Other.mGroups);
+    mRequiredMask    = move(Other.mRequiredMask);
+    mRequiring       = move(Other.mRequiring);
+    mRequirements    = move(Other.mRequirements);
+    mImplying        = move(Other.mImplying);
+    mImplied         = move(Other.mImplied);
+    mIsConstraintsCompiled = exchange_basic(Other.mIsConstraintsCompiled, false);
+    mConstraintsRevision   = exchange_basic(Other.mConstraintsRevision, 0);
+    mHelp            = move(Other.mHelp);
+    mHelpWidth       = exchange_basic(Other.mHelpWidth, 0);
+    mHelpRevision    = exchange_basic(Other.mHelpRevision, 0);
+    mUsageSize       = exchange_basic(Other.mUsageSize, 0);
+    mIsResponseFilesEnabled = Other.mIsResponseFilesEnabled;
+    mIsAbbreviationsEnabled = Other.mIsAbbreviationsEnabled;
+}
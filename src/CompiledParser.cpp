@@ -0,0 +1,109 @@
+/**
+ * @file CompiledParser.cpp
+ * @brief Definition of immutable CLI arguments parser
+ *
+ * @version 1.0.0
+ * @authors Eugene Azimut
+ * @copyright Copyright (c) Eugene Azimut, 2026
+ */
+#include <argparse/CompiledParser.hpp>
+#include <argparse/ArgumentParser.hpp>
+
+using namespace std;
+using namespace argparse;
+using namespace argparse::args;
+using namespace argparse::OptStyles;
+
+
+
+CompiledParser::CompiledParser(const ArgumentParser &Parser):
+mParser(freeze(Parser)) {}
+
+CompiledParser::CompiledParser(const CompiledParser &Other):
+mParser(Other.mParser) {}
+
+CompiledParser::~CompiledParser() noexcept {}
+
+CompiledParser &CompiledParser::operator=(const CompiledParser &Other) {
+    mParser = Other.mParser;
+    return *this;
+}
+
+shared_ptr<ArgumentParser> CompiledParser::freeze(const ArgumentParser &Parser) {
+    shared_ptr<ArgumentParser> Frozen = make_shared<ArgumentParser>();
+
+    // The style is never changed in place: ArgumentParser::setOptionStyle replaces it
+    Frozen->mStyle      = Parser.mStyle;
+    Frozen->mFlagIndex  = Parser.mFlagIndex;
+    Frozen->mShortFlags = Parser.mShortFlags;
+    Frozen->mFlagTrie   = Parser.mFlagTrie;
+    Frozen->mConfigFile = Parser.mConfigFile;
+    Frozen->mIsResponseFilesEnabled = Parser.mIsResponseFilesEnabled;
+    Frozen->mIsAbbreviationsEnabled = Parser.mIsAbbreviationsEnabled;
+
+    // Copies keep the actual types to validate values, their callbacks are never invoked
+    Frozen->mOptionals.reserve(Parser.mOptionals.size());
+    for (uint32_t i = 0; i < Parser.mOptionals.size(); ++i) {
+        Frozen->mOptionals.push_back(Parser.mCopiers[i](*Parser.mOptionals[i]));
+    }
+    Frozen->mCopiers = Parser.mCopiers;
+
+    Frozen->mPositionals = Parser.mPositionals;
+
+    // Constraints are compiled now: the frozen parser never changes
+    Frozen->mGroups = Parser.mGroups;
+    Frozen->compileConstraints();
+
+    // Subcommands are built now for the same reason
+    Frozen->mSubcommandIndex = Parser.mSubcommandIndex;
+    Frozen->mSubcommands.reserve(Parser.mSubcommands.size());
+    for (uint32_t i = 0; i < Parser.mSubcommands.size(); ++i) {
+        const ArgumentParser::Subcommand &Command = Parser.mSubcommands[i];
+        ArgumentParser::Subcommand Copy = {
+            Command.Name, Command.Help, Command.Factory, freeze(Parser.buildSubcommand(i))
+        };
+        Frozen->mSubcommands.push_back(move(Copy));
+    }
+
+    return Frozen;
+}
+
+const OptionStyle &CompiledParser::getOptionStyle() const {
+    return mParser->getOptionStyle();
+}
+
+bool CompiledParser::isResponseFilesEnabled() const {
+    return mParser->isResponseFilesEnabled();
+}
+
+bool CompiledParser::isAbbreviationsEnabled() const {
+    return mParser->isAbbreviationsEnabled();
+}
+
+const string &CompiledParser::getConfigFile() const {
+    return mParser->getConfigFile();
+}
+
+size_t CompiledParser::size() const {
+    return mParser->mOptionals.size();
+}
+
+void CompiledParser::parse(int argc, const char *argv[], ParseResult &Result) const {
+    mParser->parse(argc, argv, Result);
+}
+
+ArgparseError CompiledParser::tryParse(int argc, const char *argv[], ParseResult &Result) const {
+    return mParser->tryParse(argc, argv, Result);
+}
+
+uint32_t CompiledParser::indexOf(const StringView &Flag) const {
+    return mParser->indexOf(Flag);
+}
+
+vector<string> CompiledParser::getSuggestions(const StringView &Flag, size_t MaxDistance) const {
+    return mParser->getSuggestions(Flag, MaxDistance);
+}
+
+vector<string> CompiledParser::getCandidates(const StringView &Prefix) const {
+    return mParser->getCandidates(Prefix);
+}
@@ -0,0 +1,117 @@
+/**
+ * @file FlagIndex.cpp
+ * @brief Definition of hashed flag index
+ *
+ * @version 1.0.0
+ * @authors Eugene Azimut
+ * @copyright Copyright (c) Eugene Azimut, 2026
+ */
+#include <argparse/FlagIndex.hpp>
+#include <argparse/helpers.hpp>
+
+#include <cstring>
+#include <stdexcept>
+#include <utility>
+
+using namespace std;
+using namespace argparse;
+
+
+
+constexpr uint32_t FlagIndex::NOT_FOUND;
+
+namespace {
+    constexpr size_t   INITIAL_CAPACITY = 16;                    ///< Initial number of slots
+    constexpr uint64_t FNV_OFFSET_BASIS = 14695981039346656037ull;
+    constexpr uint64_t FNV_PRIME        = 1099511628211ull;
+}
+
+
+
+FlagIndex::FlagIndex():
+mSlots(), mPool(), mSize(0) {}
+
+FlagIndex::FlagIndex(const FlagIndex &Other):
+mSlots(Other.mSlots), mPool(Other.mPool), mSize(Other.mSize) {}
+
+FlagIndex::FlagIndex(FlagIndex &&Other) noexcept:
+mSlots(move(Other.mSlots)), mPool(move(Other.mPool)), mSize(exchange_basic(Other.mSize, 0)) {}
+
+FlagIndex::~FlagIndex() noexcept {}
+
+void FlagIndex::insert(const StringView &Key, uint32_t Value) {
+    if (Value == NOT_FOUND) {
+        throw invalid_argument("argparse::FlagIndex::insert(const StringView &, uint32_t): invalid value");
+    }
+
+    if ((mSize + 1) * 2 > mSlots.size()) grow();
+
+    const uint64_t Hash = hash(Key);
+    Slot &Found = mSlots[probe(Key, Hash)];
+    if (Found.Value != NOT_FOUND) {
+        throw invalid_argument(
+            string("argparse::FlagIndex::insert(const StringView &, uint32_t): conflicting flag - ") +
+            Key.toString()
+        );
+    }
+
+    Found.Hash   = Hash;
+    Found.Offset = static_cast<uint32_t>(mPool.size());
+    Found.Size   = static_cast<uint32_t>(Key.size());
+    Found.Value  = Value;
+    mPool.append(Key.data(), Key.size());
+    ++mSize;
+}
+
+uint32_t FlagIndex::find(const StringView &Key) const {
+    if (mSize == 0) return NOT_FOUND;
+    return mSlots[probe(Key, hash(Key))].Value;
+}
+
+size_t FlagIndex::size() const {
+    return mSize;
+}
+
+void FlagIndex::clear() {
+    mSlots.clear();
+    mPool.clear();
+    mSize = 0;
+}
+
+uint64_t FlagIndex::hash(const StringView &Key) {
+    uint64_t Hash = FNV_OFFSET_BASIS;
+    for (size_t i = 0; i < Key.size(); ++i) {
+        Hash ^= static_cast<unsigned char>(Key[i]);
+        Hash *= FNV_PRIME;
+    }
+    return Hash;
+}
+
+size_t FlagIndex::probe(const StringView &Key, uint64_t Hash) const {
+    const size_t Mask = mSlots.size() - 1;
+    for (size_t i = static_cast<size_t>(Hash) & Mask;; i = (i + 1) & Mask) {
+        const Slot &Current = mSlots[i];
+        if (Current.Value == NOT_FOUND) return i;
+        if (
+            Current.Hash == Hash && Current.Size == Key.size() &&
+            memcmp(mPool.data() + Current.Offset, Key.data(), Key.size()) == 0
+        ) {
+            return i;
+        }
+    }
+}
+
+void FlagIndex::grow() {
+    const Slot Empty = {0, 0, 0, NOT_FOUND};
+    vector<Slot> Old(mSlots.empty() ? INITIAL_CAPACITY : mSlots.size() * 2, Empty);
+    Old.swap(mSlots);
+
+    const size_t Mask = mSlots.size() - 1;
+    for (const Slot &Current: Old) {
+        if (Current.Value == NOT_FOUND) continue;
+
+        size_t i = static_cast<size_t>(Current.Hash) & Mask;
+        while (mSlots[i].Value != NOT_FOUND) i = (i + 1) & Mask;
+        mSlots[i] = Current;
+    }
+}
@@ -0,0 +1,83 @@
+/**
+ * @file FlagTrie.cpp
+ * @brief Definition of prefix tree of flags
+ *
+ * @version 1.0.0
+ * @authors Eugene Azimut
+ * @copyright Copyright (c) Eugene Azimut, 2026
+ */
+#include <argparse/FlagTrie.hpp>
+
+#include <stdexcept>
+#include <utility>
+
+using namespace std;
+using namespace argparse;
+
+
+
+constexpr uint32_t FlagTrie::NOT_FOUND;
+constexpr uint32_t FlagTrie::AMBIGUOUS;
+
+
+
+FlagTrie::FlagTrie():
+mNodes() {}
+
+FlagTrie::FlagTrie(const FlagTrie &Other):
+mNodes(Other.mNodes) {}
+
+FlagTrie::FlagTrie(FlagTrie &&Other) noexcept:
+mNodes(move(Other.mNodes)) {}
+
+FlagTrie::~FlagTrie() noexcept {}
+
+void FlagTrie::insert(const StringView &Key, uint32_t Value) {
+    if (Value == NOT_FOUND || Value == AMBIGUOUS) {
+        throw invalid_argument("argparse::FlagTrie::insert(const StringView &, uint32_t): invalid value");
+    }
+
+    if (mNodes.empty()) mNodes.push_back(Node{0, 0, Value, '\0'});
+
+    uint32_t Current = 0;
+    for (size_t i = 0;; ++i) {
+        Node &Visited = mNodes[Current];
+        if (Visited.Value != Value) Visited.Value = AMBIGUOUS;
+        if (i == Key.size()) break;
+
+        uint32_t Next = child(Current, Key[i]);
+        if (Next == 0) {
+            Next = static_cast<uint32_t>(mNodes.size());
+            // Push first: it may invalidate references to nodes
+            mNodes.push_back(Node{0, mNodes[Current].FirstChild, Value, Key[i]});
+            mNodes[Current].FirstChild = Next;
+        }
+        Current = Next;
+    }
+}
+
+uint32_t FlagTrie::find(const StringView &Prefix) const {
+    if (mNodes.empty()) return NOT_FOUND;
+
+    uint32_t Current = 0;
+    for (size_t i = 0; i < Prefix.size(); ++i) {
+        Current = child(Current, Prefix[i]);
+        if (Current == 0) return NOT_FOUND;
+    }
+    return mNodes[Current].Value;
+}
+
+size_t FlagTrie::size() const {
+    return mNodes.size();
+}
+
+void FlagTrie::clear() {
+    mNodes.clear();
+}
+
+uint32_t FlagTrie::child(uint32_t Parent, char Label) const {
+    for (uint32_t Child = mNodes[Parent].FirstChild; Child != 0; Child = mNodes[Child].NextSibling) {
+        if (mNodes[Child].Label == Label) return Child;
+    }
+    return 0;
+}
@@ -0,0 +1,204 @@
+/**
+ * @file HelpFormatter.cpp
+ * @brief Definition of help text formatter
+ *
+ * @version 1.0.0
+ * @authors Eugene Azimut
+ * @copyright Copyright (c) Eugene Azimut, 2026
+ */
+#include <argparse/HelpFormatter.hpp>
+
+#include <algorithm>
+#include <cstdlib>
+
+#if defined(_WIN32)
+    #ifndef NOMINMAX
+        #define NOMINMAX
+    #endif
+    #include <io.h>
+    #include <windows.h>
+#else
+    #include <sys/ioctl.h>
+    #include <unistd.h>
+#endif
+
+using namespace std;
+using namespace argparse;
+
+
+
+constexpr size_t HelpFormatter::DEFAULT_WIDTH;
+constexpr size_t HelpFormatter::MIN_WIDTH;
+constexpr size_t HelpFormatter::MAX_HELP_COLUMN;
+
+namespace {
+    constexpr size_t INDENT    = 2;     ///< Indent of entries
+    constexpr size_t GAP       = 2;     ///< Minimum gap between columns of entries
+    const StringView USAGE_PREFIX("usage: ");
+}
+
+
+
+HelpFormatter::HelpFormatter(size_t Width):
+mWidth(max(Width, MIN_WIDTH)), mBlocks() {}
+
+void HelpFormatter::addUsage(const StringView &Program, const vector<string> &Items) {
+    const Block New = {USAGE, Program, StringView(), &Items};
+    mBlocks.push_back(New);
+}
+
+void HelpFormatter::addText(const StringView &Text) {
+    const Block New = {TEXT, StringView(), Text, nullptr};
+    mBlocks.push_back(New);
+}
+
+void HelpFormatter::addSection(const StringView &Title) {
+    const Block New = {SECTION, Title, StringView(), nullptr};
+    mBlocks.push_back(New);
+}
+
+void HelpFormatter::addEntry(const StringView &Left, const StringView &Help) {
+    const Block New = {ENTRY, Left, Help, nullptr};
+    mBlocks.push_back(New);
+}
+
+void HelpFormatter::render(string &Out) const {
+    size_t LongestLeft = 0;
+    for (const Block &Item: mBlocks) {
+        if (Item.Type == ENTRY) LongestLeft = max(LongestLeft, Item.Left.size());
+    }
+    const size_t HelpColumn = min(INDENT + LongestLeft + GAP, min(MAX_HELP_COLUMN, mWidth / 2));
+
+    // Upper bound of the text size: every wrapped line costs at most its indent and a newline
+    size_t Capacity = Out.size();
+    for (const Block &Item: mBlocks) {
+        const size_t Lines = Item.Text.size() / (mWidth - HelpColumn) + 2;
+        Capacity += INDENT + Item.Left.size() + Item.Text.size() + Lines * (HelpColumn + 1) + 2;
+        if (Item.Items) {
+            for (const string &Part: *Item.Items) Capacity += Part.size() + USAGE_PREFIX.size() + Item.Left.size() + 2;
+        }
+    }
+    Out.reserve(Capacity);
+
+    for (const Block &Item: mBlocks) {
+        switch (Item.Type) {
+            case USAGE: {
+                Out.append(USAGE_PREFIX.data(), USAGE_PREFIX.size());
+                Out.append(Item.Left.data(), Item.Left.size());
+
+                const size_t Indent = USAGE_PREFIX.size() + Item.Left.size() + 1;
+                size_t Column = Indent - 1;
+                for (const string &Part: *Item.Items) {
+                    if (Column > Indent && Column + 1 + Part.size() > mWidth) {
+                        Out += '\n';
+                        Out.append(Indent, ' ');
+                        Column = Indent;
+                    } else {
+                        Out += ' ';
+                        ++Column;
+                    }
+                    Out += Part;
+                    Column += Part.size();
+                }
+                Out += '\n';
+                break;
+            }
+
+            case TEXT:
+                Out += '\n';
+                wrap(Out, Item.Text, 0, 0);
+                Out += '\n';
+                break;
+
+            case SECTION:
+                Out += '\n';
+                Out.append(Item.Left.data(), Item.Left.size());
+                Out += '\n';
+                break;
+
+            case ENTRY: {
+                Out.append(INDENT, ' ');
+                Out.append(Item.Left.data(), Item.Left.size());
+                if (Item.Text.empty()) {
+                    Out += '\n';
+                    break;
+                }
+
+                const size_t Column = INDENT + Item.Left.size();
+                if (Column + GAP > HelpColumn) {
+                    // Long left column: help starts on the next line
+                    Out += '\n';
+                    Out.append(HelpColumn, ' ');
+                } else {
+                    Out.append(HelpColumn - Column, ' ');
+                }
+                wrap(Out, Item.Text, HelpColumn, HelpColumn);
+                Out += '\n';
+                break;
+            }
+        }
+    }
+}
+
+size_t HelpFormatter::getTerminalWidth(int Fd) {
+#if defined(_WIN32)
+    CONSOLE_SCREEN_BUFFER_INFO Info;
+    const HANDLE Console = reinterpret_cast<HANDLE>(_get_osfhandle(Fd));
+    if (Console != INVALID_HANDLE_VALUE && GetConsoleScreenBufferInfo(Console, &Info)) {
+        return static_cast<size_t>(Info.srWindow.Right - Info.srWindow.Left + 1);
+    }
+#else
+    struct winsize Size;
+    if (ioctl(Fd, TIOCGWINSZ, &Size) == 0 && Size.ws_col > 0) {
+        return Size.ws_col;
+    }
+#endif
+
+    const char *Columns = getenv("COLUMNS");
+    if (Columns) {
+        char *End = nullptr;
+        const unsigned long Width = strtoul(Columns, &End, 10);
+        if (End != Columns && *End == '\0' && Width > 0) return static_cast<size_t>(Width);
+    }
+    return DEFAULT_WIDTH;
+}
+
+void HelpFormatter::wrap(string &Out, const StringView &Text, size_t Column, size_t Indent) const {
+    bool IsLineStart = true;    ///< Whether or not no word of Text is on the current line yet
+    size_t Pos = 0;
+    while (Pos < Text.size()) {
+        if (Text[Pos] == ' ') {
+            ++Pos;
+            continue;
+        }
+        if (Text[Pos] == '\n') {
+            // Explicit line break of the text
+            Out += '\n';
+            Out.append(Indent, ' ');
+            Column = Indent;
+            IsLineStart = true;
+            ++Pos;
+            continue;
+        }
+
+        size_t End = Pos;
+        while (End < Text.size() && Text[End] != ' ' && Text[End] != '\n') ++End;
+        const size_t WordSize = End - Pos;
+
+        if (!IsLineStart && Column + 1 + WordSize > mWidth) {
+            Out += '\n';
+            Out.append(Indent, ' ');
+            Column = Indent;
+            IsLineStart = true;
+        }
+        if (!IsLineStart) {
+            Out += ' ';
+            ++Column;
+        }
+
+        Out.append(Text.data() + Pos, WordSize);
+        Column += WordSize;
+        IsLineStart = false;
+        Pos = End;
+    }
+}
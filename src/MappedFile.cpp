@@ -0,0 +1,144 @@
+/**
+ * @file MappedFile.cpp
+ * @brief Definition of memory-mapped file
+ *
+ * @version 1.0.0
+ * @authors Eugene Azimut
+ * @copyright Copyright (c) Eugene Azimut, 2026
+ */
+#include <argparse/MappedFile.hpp>
+#include <argparse/helpers.hpp>
+
+#if defined(_WIN32)
+    #include <windows.h>
+#else
+    #include <cerrno>
+    #include <fcntl.h>
+    #include <sys/mman.h>
+    #include <sys/stat.h>
+    #include <unistd.h>
+#endif
+
+using namespace std;
+using namespace argparse;
+
+
+
+MappedFile::MappedFile():
+mData(nullptr), mSize(0) {}
+
+MappedFile::MappedFile(MappedFile &&Other) noexcept:
+mData(exchange_basic(Other.mData, nullptr)),
+mSize(exchange_basic(Other.mSize, 0)) {}
+
+MappedFile::~MappedFile() noexcept {
+    unmap();
+}
+
+MappedFile &MappedFile::operator=(MappedFile &&Other) noexcept {
+    if (this != &Other) {
+        unmap();
+        mData = exchange_basic(Other.mData, nullptr);
+        mSize = exchange_basic(Other.mSize, 0);
+    }
+    return *this;
+}
+
+char *MappedFile::data() const {
+    return mData;
+}
+
+size_t MappedFile::size() const {
+    return mSize;
+}
+
+#if defined(_WIN32)
+bool MappedFile::map(const string &Path) noexcept {
+    unmap();
+
+    HANDLE File = CreateFileA(
+        Path.c_str(), GENERIC_READ, FILE_SHARE_READ, nullptr,
+        OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL | FILE_FLAG_SEQUENTIAL_SCAN, nullptr
+    );
+    if (File == INVALID_HANDLE_VALUE) return false;
+
+    LARGE_INTEGER Size;
+    if (!GetFileSizeEx(File, &Size)) {
+        CloseHandle(File);
+        return false;
+    }
+    if (Size.QuadPart == 0) {
+        // Empty files can't be mapped
+        CloseHandle(File);
+        return true;
+    }
+
+    HANDLE Mapping = CreateFileMappingA(File, nullptr, PAGE_WRITECOPY, 0, 0, nullptr);
+    CloseHandle(File);
+    if (!Mapping) return false;
+
+    // The view keeps the mapping alive
+    void *View = MapViewOfFile(Mapping, FILE_MAP_COPY, 0, 0, 0);
+    CloseHandle(Mapping);
+    if (!View) return false;
+
+    mData = static_cast<char *>(View);
+    mSize = static_cast<size_t>(Size.QuadPart);
+    return true;
+}
+
+bool MappedFile::isMissing(const string &Path) noexcept {
+    if (GetFileAttributesA(Path.c_str()) != INVALID_FILE_ATTRIBUTES) return false;
+
+    const DWORD Error = GetLastError();
+    return Error == ERROR_FILE_NOT_FOUND || Error == ERROR_PATH_NOT_FOUND;
+}
+
+void MappedFile::unmap() noexcept {
+    if (mData) UnmapViewOfFile(mData);
+    mData = nullptr;
+    mSize = 0;
+}
+#else
+bool MappedFile::map(const string &Path) noexcept {
+    unmap();
+
+    const int File = open(Path.c_str(), O_RDONLY);
+    if (File < 0) return false;
+
+    struct stat Info;
+    if (fstat(File, &Info) != 0 || !S_ISREG(Info.st_mode)) {
+        close(File);
+        return false;
+    }
+    if (Info.st_size == 0) {
+        // Empty files can't be mapped
+        close(File);
+        return true;
+    }
+
+    // The mapping keeps the file alive
+    void *View = mmap(
+        nullptr, static_cast<size_t>(Info.st_size),
+        PROT_READ | PROT_WRITE, MAP_PRIVATE, File, 0
+    );
+    close(File);
+    if (View == MAP_FAILED) return false;
+
+    mData = static_cast<char *>(View);
+    mSize = static_cast<size_t>(Info.st_size);
+    return true;
+}
+
+bool MappedFile::isMissing(const string &Path) noexcept {
+    struct stat Info;
+    if (stat(Path.c_str(), &Info) == 0) return false;
+    return errno == ENOENT || errno == ENOTDIR;
+}
+
+void MappedFile::unmap() noexcept {
+    if (mData) munmap(mData, mSize);
+    mData = nullptr;
+    mSize = 0;
+}
+#endif
@@ -7,10 +7,77 @@
  * @copyright Copyright (c) Eugene Azimut, 2026
  */
 #include <argparse/OptionStyles/OptionStyle.hpp>
+#include "simd.hpp"
+
+#include <cstdint>
 
 using namespace std;
 using namespace argparse;
 using namespace argparse::OptStyles;
+using argparse::detail::lowestBit;
+
+
+
+namespace {
+#if defined(ARGPARSE_USE_AVX2) || defined(ARGPARSE_USE_SSE2)
+    #if defined(ARGPARSE_USE_AVX2)
+    constexpr size_t CHUNK_SIZE = 32;   ///< Bytes compared at once
+
+    /**
+     * @brief Compares aligned chunk with the terminator
+     * @param[in] Chunk Aligned chunk
+     * @return Bit per byte equal to the terminator
+     */
+    ARGPARSE_NO_SANITIZE_ADDRESS
+    uint32_t compareChunk(const char *Chunk) {
+        const __m256i Data = _mm256_load_si256(reinterpret_cast<const __m256i *>(Chunk));
+        return static_cast<uint32_t>(_mm256_movemask_epi8(_mm256_cmpeq_epi8(Data, _mm256_setzero_si256())));
+    }
+    #else
+    constexpr size_t CHUNK_SIZE = 16;   ///< Bytes compared at once
+
+    /**
+     * @brief Compares aligned chunk with the terminator
+     * @param[in] Chunk Aligned chunk
+     * @return Bit per byte equal to the terminator
+     */
+    ARGPARSE_NO_SANITIZE_ADDRESS
+    uint32_t compareChunk(const char *Chunk) {
+        const __m128i Data = _mm_load_si128(reinterpret_cast<const __m128i *>(Chunk));
+        return static_cast<uint32_t>(_mm_movemask_epi8(_mm_cmpeq_epi8(Data, _mm_setzero_si128())));
+    }
+    #endif
+#endif
+
+    /**
+     * @brief Measures null-terminated Arg
+     * @details Vector version reads aligned chunks: a chunk never crosses a page boundary,
+     * so reading past the terminator is safe
+     *
+     * @param[in] Arg Null-terminated argument
+     * @return Length of Arg
+     */
+    ARGPARSE_NO_SANITIZE_ADDRESS
+    size_t scanArg(const char *Arg) {
+    #if defined(ARGPARSE_USE_AVX2) || defined(ARGPARSE_USE_SSE2)
+        const uintptr_t Address = reinterpret_cast<uintptr_t>(Arg);
+        const size_t Offset = Address & (CHUNK_SIZE - 1);
+        const char *Chunk = reinterpret_cast<const char *>(Address - Offset);
+
+        // Bytes before Arg are ignored
+        uint32_t ZeroMask = compareChunk(Chunk) & (~0u << Offset);
+        while (!ZeroMask) {
+            Chunk += CHUNK_SIZE;
+            ZeroMask = compareChunk(Chunk);
+        }
+        return static_cast<size_t>(Chunk - Arg) + lowestBit(ZeroMask);
+    #else
+        size_t Length = 0;
+        while (Arg[Length]) ++Length;
+        return Length;
+    #endif
+    }
+}
 
 
 
@@ -57,42 +124,99 @@ bool OptionStyle::isArgOptional(const string &Arg) const {
 }
 
 void OptionStyle::splitArg(const string &Arg, string &Option, string &Value) const {
-    if (!isArgOptional(Arg)) {
-        // TODO: throw ArgparseError("not an optional")
-        throw runtime_error("Not an optional");
+    StringView Opt, Val;
+    const ErrorCode Code = trySplitArg(Arg, Opt, Val);
+    if (Code != SUCCESS) {
+        throw runtime_error(getErrorMessage(Code));
+    }
+
+    string OptCopy = Opt.toString();
+    string ValCopy = Val.toString();
+
+    // Return
+    Option = move(OptCopy);
+    Value  = move(ValCopy);
+}
+
+ErrorCode OptionStyle::trySplitArg(const StringView &Arg, StringView &Option, StringView &Value) const noexcept {
+    Token Tok;
+    const ErrorCode Code = tryTokenize(Arg, Tok);
+    if (Code != SUCCESS) return Code;
+
+    if (Tok.Kind == POSITIONAL) return NOT_AN_OPTION;
+    if (Tok.Kind == TERMINATOR) return INVALID_OPTION;
+
+    Option = Tok.Option;
+    Value  = Tok.Value;
+    return SUCCESS;
+}
+
+Token OptionStyle::tokenize(const StringView &Arg) const {
+    Token Tok;
+    const ErrorCode Code = tryTokenize(Arg, Tok);
+    if (Code != SUCCESS) {
+        throw runtime_error(getErrorMessage(Code));
+    }
+    return Tok;
+}
+
+ErrorCode OptionStyle::tryTokenize(const StringView &Arg, Token &Tok) const noexcept {
+    Tok = Token();
+    Tok.Value = Arg;
+
+    const StringView Indicator(mIndicator);
+    if (Arg.size() <= Indicator.size() || !Arg.startsWith(Indicator)) {
+        // Not an optional
+        return SUCCESS;
     }
 
-    size_t DelimPos = Arg.find(mValueDelim);
     /*
-       std::string::find(const std::string &__str) returns 0
-       if __str is an empty string, which means
-       value cannot be provided in this Style.
+       Empty mValueDelim means value cannot be provided in this Style.
        So the whole string is an option
     */
-    if (DelimPos == 0) DelimPos = string::npos;
+    size_t DelimPos = StringView::npos;
+    if (!mValueDelim.empty()) DelimPos = Arg.find(StringView(mValueDelim), Indicator.size());
 
     // Extract option
-    string Opt = Arg.substr(mIndicator.length(), DelimPos - mIndicator.length());
-    if (Option.empty()) {
+    StringView Opt = Arg.substr(Indicator.size(), DelimPos - Indicator.size());
+    if (Opt.empty()) {
         /*
            Option wasn't provided!
            Examples:
-            * "/"           mValueDelim doesn't matter
             * "/:"          in case of mValueDelim == ":"
             * "/:Value"     in case of mValueDelim == ":"
-           TODO: throw ArgparseError("option wasn't provided")
         */
-       throw runtime_error("Option wasn't provided");
+        return OPTION_NOT_PROVIDED;
     }
 
+    Tok.Kind   = OPTION;
+    Tok.Flag   = Arg.substr(0, DelimPos);
+    Tok.Option = Opt;
+    Tok.Value  = StringView();
+
     // Extract value if provided
-    string Val = "";
-    if (DelimPos != string::npos) {
-        // Value is provided
-        Val = move(Arg.substr(DelimPos + mValueDelim.length()));
+    if (DelimPos != StringView::npos) {
+        Tok.Value    = Arg.substr(DelimPos + mValueDelim.length());
+        Tok.HasValue = true;
     }
 
-    // Return
-    Option = move(Opt);
-    Value  = move(Val);
+    return SUCCESS;
+}
+
+void OptionStyle::classify(const char *const Args[], size_t Count, TokenClass Classes[]) const noexcept {
+    const char Indicator = mIndicator[0];
+
+    for (size_t i = 0; i < Count; ++i) {
+        const char *Arg = Args[i];
+        TokenClass &Class = Classes[i];
+
+        if (!Arg) {
+            Class.Length = 0;
+            Class.Kind   = POSITIONAL;
+            continue;
+        }
+
+        Class.Length = static_cast<uint32_t>(scanArg(Arg));
+        Class.Kind   = Arg[0] == Indicator ? OPTION : POSITIONAL;
+    }
 }
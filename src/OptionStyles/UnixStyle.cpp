@@ -42,82 +42,81 @@ bool UnixStyle::isArgOptional(const string &Arg) const {
     return false;
 }
 
-void UnixStyle::splitArg(const string &Arg, string &Option, string &Value) const {
-    if (!isArgOptional(Arg)) {
-        // TODO: throw ArgparseError("not an optional")
-        throw runtime_error("Not an optional");
+ErrorCode UnixStyle::tryTokenize(const StringView &Arg, Token &Tok) const noexcept {
+    Tok = Token();
+    Tok.Value = Arg;
+
+    if (Arg.empty() || Arg[0] != mShortIndicator) {
+        // Not an optional
+        return SUCCESS;
     }
 
-    string Opt = "";
-    string Val = "";
+    const StringView LongIndicator(mLongIndicator);
+    const StringView ValueDelim(mValueDelim);
 
-    if (Arg.substr(0, mLongIndicator.length()) == mLongIndicator) {
+    if (Arg.startsWith(LongIndicator)) {
         //* Long option
-        if (Arg.length() == 2) {
+        if (Arg.size() == LongIndicator.size()) {
             // Arg == "--"
-            // TODO: throw ArgparseError("Invalid option (option not provided)")
-            throw runtime_error("Invalid option (option not provided)");
+            Tok.Kind  = TERMINATOR;
+            Tok.Value = StringView();
+            return SUCCESS;
         }
 
-        size_t DelimPos = Arg.find(mValueDelim);
-
-        // Extract value
-        if (DelimPos != string::npos) {
-            //* Value should have been provided
-            // Maybe empty
-            Val = move(Arg.substr(DelimPos + mValueDelim.length()));
-        }
+        size_t DelimPos = Arg.find(ValueDelim, LongIndicator.size());
 
         // Extract option
-        Opt = move(Arg.substr(mLongIndicator.length(), DelimPos - mLongIndicator.length()));
+        StringView Opt = Arg.substr(LongIndicator.size(), DelimPos - LongIndicator.size());
         if (Opt.empty()) {
             // Option wasn't provided
-            if (DelimPos == string::npos) {
-                // mValueDelim wasn't found
-                // It seems Arg == "--"
-                // TODO: throw ArgparseError("Invalid option (option not provided)")
-                throw runtime_error("Invalid option (option not provided)");
+            // mValueDelim was found right after indicator
+            // It seems Arg == "--=*"
+            if (DelimPos + ValueDelim.size() == Arg.size()) {
+                // It seems Arg == "--="
+                return DELIMITER_AS_OPTION;
             } else {
-                // mValueDelim was found
-                // It seems Arg == "--=*"
-                if (Val.empty()) {
-                    // It seems Arg == "--="
-                    // TODO: throw ArgparseError("Value delimiter (\"=\") cannot be an option")
-                    throw runtime_error("Value delimiter (\"=\") cannot be an option");
-                } else {
-                    // It seems Arg == "--=+"
-                    // TODO: throw ArgparseError("Invalid option (option not provided)")
-                    throw runtime_error("Invalid option (option not provided)");
-                }
+                // It seems Arg == "--=+"
+                return INVALID_OPTION;
             }
         }
+
+        Tok.Kind   = LONG_OPTION;
+        Tok.Flag   = Arg.substr(0, DelimPos);
+        Tok.Option = Opt;
+        Tok.Value  = StringView();
+
+        // Extract value
+        if (DelimPos != StringView::npos) {
+            //* Value should have been provided
+            // Maybe empty
+            Tok.Value    = Arg.substr(DelimPos + ValueDelim.size());
+            Tok.HasValue = true;
+        }
     } else {
         //* Short option
         // Extract option
-        if (Arg.length() == 1) {
+        if (Arg.size() == 1) {
             // Arg == "-"
-            // TODO: throw ArgparseError("Invalid option (option not provided)")
-            throw runtime_error("Invalid option (option not provided)");
+            return INVALID_OPTION;
         }
 
-        Opt = Arg[1];
-        if (Opt == mValueDelim) {
+        if (Arg.substr(1, 1) == ValueDelim) {
             // Arg == "-=*"
-            // TODO: throw ArgparseError("Value delimiter (\"=\") cannot be an option")
-            throw runtime_error("Value delimiter (\"=\") cannot be an option");
+            return DELIMITER_AS_OPTION;
         }
 
         // Extract value
-        size_t DelimPos = Arg.find(mValueDelim, 2);
-        if (DelimPos == 2) {
+        if (Arg.find(ValueDelim, 2) == 2) {
             // It seems Arg == "-f=*"
-            // TODO: throw ArgparseError("UnixStyle doesn't support value delimiters in short options")
-            throw runtime_error("UnixStyle doesn't support value delimiters in short options");
+            return SHORT_OPTION_DELIMITER;
         }
 
-        Val = move(Arg.substr(2));
+        Tok.Kind     = SHORT_OPTION;
+        Tok.Flag     = Arg.substr(0, 2);
+        Tok.Option   = Arg.substr(1, 1);
+        Tok.Value    = Arg.substr(2);
+        Tok.HasValue = Arg.size() > 2;
     }
 
-    Option = move(Opt);
-    Value  = move(Val);
+    return SUCCESS;
 }
@@ -0,0 +1,169 @@
+/**
+ * @file ParseResult.cpp
+ * @brief Definition of CLI parsing result
+ *
+ * @version 1.0.0
+ * @authors Eugene Azimut
+ * @copyright Copyright (c) Eugene Azimut, 2026
+ */
+#include <argparse/ParseResult.hpp>
+#include <argparse/helpers.hpp>
+
+#include <stdexcept>
+#include <utility>
+
+using namespace std;
+using namespace argparse;
+
+
+
+ParseResult::ValueIterator::ValueIterator(const Event *Current):
+mCurrent(Current) {
+    while (mCurrent && !mCurrent->IsValue) mCurrent = mCurrent->Next;
+}
+
+const StringView &ParseResult::ValueIterator::operator*() const {
+    return mCurrent->Value;
+}
+
+ParseResult::ValueIterator &ParseResult::ValueIterator::operator++() {
+    mCurrent = mCurrent->Next;
+    while (mCurrent && !mCurrent->IsValue) mCurrent = mCurrent->Next;
+    return *this;
+}
+
+bool ParseResult::ValueIterator::operator!=(const ValueIterator &Other) const {
+    return mCurrent != Other.mCurrent;
+}
+
+
+
+ParseResult::ParseResult(size_t ArenaBlockSize):
+mArena(ArenaBlockSize), mSlots(nullptr), mSize(0), mFiles(), mSeen(nullptr), mSeenWords(0),
+mSubcommand(UINT32_MAX), mSubcommandName(), mSubcommandResult() {}
+
+ParseResult::ParseResult(ParseResult &&Other) noexcept:
+mArena(move(Other.mArena)),
+mSlots(exchange_basic(Other.mSlots, nullptr)),
+mSize(exchange_basic(Other.mSize, 0)),
+mFiles(move(Other.mFiles)),
+mSeen(exchange_basic(Other.mSeen, nullptr)),
+mSeenWords(exchange_basic(Other.mSeenWords, 0)),
+mSubcommand(exchange_basic(Other.mSubcommand, UINT32_MAX)),
+mSubcommandName(exchange_basic(Other.mSubcommandName, StringView())),
+mSubcommandResult(move(Other.mSubcommandResult)) {}
+
+ParseResult::~ParseResult() noexcept {}
+
+size_t ParseResult::size() const {
+    return mSize;
+}
+
+uint32_t ParseResult::getCount(size_t Index) const {
+    return getSlot(Index).Count;
+}
+
+uint32_t ParseResult::getValuesCount(size_t Index) const {
+    return getSlot(Index).ValuesCount;
+}
+
+ParseResult::ValueRange ParseResult::getValues(size_t Index) const {
+    ValueRange Range = {ValueIterator(getSlot(Index).First)};
+    return Range;
+}
+
+Arena &ParseResult::getArena() {
+    return mArena;
+}
+
+const StringView &ParseResult::getSubcommand() const {
+    return mSubcommandName;
+}
+
+const ParseResult &ParseResult::getSubcommandResult() const {
+    if (mSubcommand == UINT32_MAX) {
+        throw logic_error("argparse::ParseResult::getSubcommandResult(): no subcommand was selected");
+    }
+    return *mSubcommandResult;
+}
+
+void ParseResult::clear() {
+    mArena.reset();
+    mSlots = nullptr;
+    mSize  = 0;
+    mFiles.clear();
+    mSeen      = nullptr;
+    mSeenWords = 0;
+
+    mSubcommand     = UINT32_MAX;
+    mSubcommandName = StringView();
+    if (mSubcommandResult) mSubcommandResult->clear();
+}
+
+void ParseResult::begin(size_t ArgumentsCount) {
+    clear();
+
+    mSlots = mArena.allocateArray<Slot>(ArgumentsCount);
+    for (size_t i = 0; i < ArgumentsCount; ++i) {
+        mSlots[i].Count       = 0;
+        mSlots[i].ValuesCount = 0;
+        mSlots[i].First       = nullptr;
+        mSlots[i].Last        = nullptr;
+    }
+    mSize = ArgumentsCount;
+
+    mSeenWords = (ArgumentsCount + 63) / 64;
+    mSeen = mArena.allocateArray<uint64_t>(mSeenWords);
+    for (size_t i = 0; i < mSeenWords; ++i) mSeen[i] = 0;
+}
+
+void ParseResult::addOccurrence(size_t Index) {
+    addEvent(Index, StringView(), false);
+    ++mSlots[Index].Count;
+    mSeen[Index >> 6] |= UINT64_C(1) << (Index & 63);
+}
+
+void ParseResult::addValue(size_t Index, const StringView &Value) {
+    addEvent(Index, Value, true);
+    ++mSlots[Index].ValuesCount;
+}
+
+void ParseResult::addEvent(size_t Index, const StringView &Value, bool IsValue) {
+    Event *New = mArena.allocateArray<Event>(1);
+    New->Next    = nullptr;
+    New->Value   = Value;
+    New->IsValue = IsValue;
+
+    Slot &Current = mSlots[Index];
+    if (Current.Last) {
+        Current.Last->Next = New;
+    } else {
+        Current.First = New;
+    }
+    Current.Last = New;
+}
+
+ParseResult &ParseResult::selectSubcommand(uint32_t Index, const StringView &Name) {
+    if (!mSubcommandResult) mSubcommandResult.reset(new ParseResult(mArena.getBlockSize()));
+
+    mSubcommand     = Index;
+    mSubcommandName = Name;
+    return *mSubcommandResult;
+}
+
+MappedFile *ParseResult::mapFile(const string &Path) {
+    MappedFile File;
+    if (!File.map(Path)) return nullptr;
+
+    mFiles.push_back(move(File));
+    return &mFiles.back();
+}
+
+const ParseResult::Slot &ParseResult::getSlot(size_t Index) const {
+    if (Index >= mSize) {
+        throw out_of_range(
+            string("argparse::ParseResult: invalid argument index - ") + to_string(Index)
+        );
+    }
+    return mSlots[Index];
+}
@@ -0,0 +1,15 @@
+/**
+ * @file StringView.cpp
+ * @brief Definition of non-owning string view
+ *
+ * @version 1.0.0
+ * @authors Eugene Azimut
+ * @copyright Copyright (c) Eugene Azimut, 2026
+ */
+#include <argparse/StringView.hpp>
+
+using namespace argparse;
+
+
+
+constexpr size_t StringView::npos;
@@ -8,10 +8,39 @@
  */
 #include <argparse/args/BooleanArg.hpp>
 #include <argparse/helpers.hpp>
+#include "args/conversion.hpp"
 
 using namespace std;
 using namespace argparse;
 using namespace argparse::args;
+using argparse::detail::equalsNoCase;
+
+
+
+namespace {
+    /**
+     * @brief Converts boolean literal Value
+     * @return false if Value isn't a literal
+     */
+    bool parseBoolean(const StringView &Value, bool &Result) noexcept {
+        static const char *const TrueValues[]  = {"true", "yes", "on", "1"};
+        static const char *const FalseValues[] = {"false", "no", "off", "0"};
+
+        for (const char *Expected: TrueValues) {
+            if (equalsNoCase(Value, Expected)) {
+                Result = true;
+                return true;
+            }
+        }
+        for (const char *Expected: FalseValues) {
+            if (equalsNoCase(Value, Expected)) {
+                Result = false;
+                return true;
+            }
+        }
+        return false;
+    }
+}
 
 
 
@@ -93,6 +122,30 @@ void BooleanArg::setDefaultValue(bool Value) {
     mDefaultValue = Value;
 }
 
+void BooleanArg::applyDefault() {
+    *mOutput = mDefaultValue;
+}
+
+void BooleanArg::applyFlag() {
+    *mOutput = mStoreValue;
+}
+
+ErrorCode BooleanArg::validateValue(const StringView &Value) const noexcept {
+    bool Converted = false;
+    return parseBoolean(Value, Converted) ? SUCCESS : INVALID_VALUE;
+}
+
+void BooleanArg::applyValue(const StringView &Value) {
+    bool Converted = false;
+    if (!parseBoolean(Value, Converted)) {
+        throw runtime_error(
+            string("argparse::BooleanArg::applyValue(const StringView &): invalid boolean value - ") +
+            Value.toString()
+        );
+    }
+    *mOutput = Converted;
+}
+
 void BooleanArg::selfCopy(const BooleanArg &Other) {
     mOutput       = Other.mOutput;
     mStoreValue   = Other.mStoreValue;
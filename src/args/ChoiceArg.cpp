@@ -0,0 +1,286 @@
+/**
+ * @file ChoiceArg.cpp
+ * @brief Definition of enumerated CLI argument
+ *
+ * @version 1.0.0
+ * @authors Eugene Azimut
+ * @copyright Copyright (c) Eugene Azimut, 2026
+ */
+#include <argparse/args/ChoiceArg.hpp>
+#include <argparse/FlagIndex.hpp>
+#include <argparse/helpers.hpp>
+
+#include <algorithm>
+#include <cstring>
+#include <stdexcept>
+
+using namespace std;
+using namespace argparse;
+using namespace argparse::args;
+
+
+
+constexpr uint32_t ChoiceArg::NOT_FOUND;
+
+namespace {
+    constexpr uint64_t FNV_OFFSET_BASIS = 14695981039346656037ull;
+    constexpr uint64_t FNV_PRIME        = 1099511628211ull;
+    constexpr uint64_t GOLDEN_GAMMA     = 0x9E3779B97F4A7C15ull;
+    constexpr uint32_t SEEDS_LIMIT      = 1u << 16;     ///< Seeds tried per bucket before changing salt
+    constexpr uint64_t SALTS_PER_SIZE   = 8;            ///< Salts tried before doubling the table
+
+    /**
+     * @brief Hashes Name
+     * @details 64-bit FNV-1a with offset basis perturbed by Salt
+     */
+    uint64_t hashName(const StringView &Name, uint64_t Salt) noexcept {
+        uint64_t Hash = FNV_OFFSET_BASIS ^ (Salt * GOLDEN_GAMMA);
+        for (size_t i = 0; i < Name.size(); ++i) {
+            Hash ^= static_cast<unsigned char>(Name[i]);
+            Hash *= FNV_PRIME;
+        }
+        return Hash;
+    }
+
+    /**
+     * @brief Finalizer of MurmurHash3: spreads every bit of X over the result
+     */
+    uint64_t mix(uint64_t X) noexcept {
+        X ^= X >> 33;
+        X *= 0xff51afd7ed558ccdull;
+        X ^= X >> 33;
+        X *= 0xc4ceb9fe1a85ec53ull;
+        X ^= X >> 33;
+        return X;
+    }
+
+    /**
+     * @brief Returns bucket of hash
+     */
+    size_t bucketOf(uint64_t Hash, size_t BucketsCount) noexcept {
+        return static_cast<size_t>(mix(Hash) % BucketsCount);
+    }
+
+    /**
+     * @brief Returns slot of hash displaced by Seed
+     */
+    size_t slotOf(uint64_t Hash, uint32_t Seed, size_t Mask) noexcept {
+        return static_cast<size_t>(mix(Hash + (Seed + 1ull) * GOLDEN_GAMMA)) & Mask;
+    }
+
+    /**
+     * @brief Places every name into its own slot
+     * @details Buckets are placed from the largest one: for every bucket the first seed
+     * which sends all its names to free slots is chosen
+     *
+     * @param[in] Hashes Hashes of names
+     * @param[out] Seeds Seed of every bucket
+     * @param[out] Slots Name index of every slot or ChoiceArg::NOT_FOUND
+     * @return false if some bucket can't be placed
+     */
+    bool place(const vector<uint64_t> &Hashes, vector<uint32_t> &Seeds, vector<uint32_t> &Slots) {
+        const size_t Mask = Slots.size() - 1;
+
+        vector<vector<uint32_t>> Buckets(Seeds.size());
+        for (size_t i = 0; i < Hashes.size(); ++i) {
+            Buckets[bucketOf(Hashes[i], Buckets.size())].push_back(static_cast<uint32_t>(i));
+        }
+
+        vector<uint32_t> Order(Buckets.size());
+        for (size_t i = 0; i < Order.size(); ++i) Order[i] = static_cast<uint32_t>(i);
+        stable_sort(Order.begin(), Order.end(), [&Buckets](uint32_t Left, uint32_t Right) {
+            return Buckets[Left].size() > Buckets[Right].size();
+        });
+
+        fill(Seeds.begin(), Seeds.end(), 0);
+        fill(Slots.begin(), Slots.end(), ChoiceArg::NOT_FOUND);
+
+        for (uint32_t Bucket: Order) {
+            const vector<uint32_t> &Names = Buckets[Bucket];
+            if (Names.empty()) break;
+
+            bool IsPlaced = false;
+            for (uint32_t Seed = 0; Seed < SEEDS_LIMIT && !IsPlaced; ++Seed) {
+                size_t Placed = 0;
+                for (; Placed < Names.size(); ++Placed) {
+                    uint32_t &Slot = Slots[slotOf(Hashes[Names[Placed]], Seed, Mask)];
+                    if (Slot != ChoiceArg::NOT_FOUND) break;
+                    Slot = Names[Placed];
+                }
+
+                IsPlaced = Placed == Names.size();
+                if (IsPlaced) {
+                    Seeds[Bucket] = Seed;
+                } else {
+                    // Roll back names of this bucket placed with the seed
+                    while (Placed-- > 0) Slots[slotOf(Hashes[Names[Placed]], Seed, Mask)] = ChoiceArg::NOT_FOUND;
+                }
+            }
+            if (!IsPlaced) return false;
+        }
+        return true;
+    }
+}
+
+
+
+ChoiceArg::ChoiceArg(
+    void *Output, Writer Store,
+    Flags &&Flags,
+    vector<Choice> &&Choices,
+    const string &Help,
+    uint32_t NArgs,
+    bool IsRequired, bool IsDeprecated,
+    int64_t StoreValue, int64_t DefaultValue):
+IOptionalArgument(move(Flags), Help, NARGS::NO_MORE, IsRequired, IsDeprecated),
+mOutput(Output), mStore(Store),
+mStoreValue(StoreValue), mDefaultValue(DefaultValue),
+mChoices(move(Choices)), mSeeds(), mSlots(), mSalt(0) {
+    setNArgs(NArgs);
+    build();
+
+    string Metavar = "{";
+    for (const Choice &Item: mChoices) {
+        if (Metavar.size() > 1) Metavar += ',';
+        Metavar += Item.Name;
+    }
+    setMetavar(Metavar + "}");
+}
+
+ChoiceArg::ChoiceArg(const ChoiceArg &Other):
+IOptionalArgument(Other) {
+    selfCopy(Other);
+}
+
+ChoiceArg::ChoiceArg(ChoiceArg &&Other) noexcept:
+IOptionalArgument(move(Other)) {
+    selfMove(move(Other));
+}
+
+ChoiceArg::~ChoiceArg() noexcept {
+    mOutput = nullptr;
+}
+
+void ChoiceArg::setNArgs(uint32_t NArgs) {
+    if (NArgs == 1 || NArgs == NARGS::ZERO_OR_ONE) {
+        IOptionalArgument::setNArgs(NArgs);
+    } else {
+        throw invalid_argument(
+            string("argparse::ChoiceArg::setNArgs(uint32_t): invalid NArgs value - ") +
+            to_string(NArgs)
+        );
+    }
+}
+
+const vector<ChoiceArg::Choice> &ChoiceArg::getChoices() const {
+    return mChoices;
+}
+
+int64_t ChoiceArg::getStoreValue() const {
+    return mStoreValue;
+}
+
+void ChoiceArg::setStoreValue(int64_t Value) {
+    mStoreValue = Value;
+}
+
+int64_t ChoiceArg::getDefaultValue() const {
+    return mDefaultValue;
+}
+
+void ChoiceArg::setDefaultValue(int64_t Value) {
+    mDefaultValue = Value;
+}
+
+uint32_t ChoiceArg::find(const StringView &Name) const noexcept {
+    if (mSlots.empty()) return NOT_FOUND;
+
+    const uint64_t Hash  = hashName(Name, mSalt);
+    const uint32_t Index = mSlots[slotOf(Hash, mSeeds[bucketOf(Hash, mSeeds.size())], mSlots.size() - 1)];
+    if (Index == NOT_FOUND) return NOT_FOUND;
+
+    const string &Candidate = mChoices[Index].Name;
+    if (Candidate.size() != Name.size()) return NOT_FOUND;
+    if (!Name.empty() && memcmp(Candidate.data(), Name.data(), Name.size()) != 0) return NOT_FOUND;
+    return Index;
+}
+
+void ChoiceArg::applyDefault() {
+    mStore(mOutput, mDefaultValue);
+}
+
+void ChoiceArg::applyFlag() {
+    mStore(mOutput, mStoreValue);
+}
+
+ErrorCode ChoiceArg::validateValue(const StringView &Value) const noexcept {
+    return find(Value) != NOT_FOUND ? SUCCESS : INVALID_VALUE;
+}
+
+void ChoiceArg::applyValue(const StringView &Value) {
+    const uint32_t Index = find(Value);
+    if (Index != NOT_FOUND) {
+        mStore(mOutput, mChoices[Index].Value);
+        return;
+    }
+
+    string Allowed;
+    for (const Choice &Item: mChoices) {
+        if (!Allowed.empty()) Allowed += ", ";
+        Allowed += Item.Name;
+    }
+    throw runtime_error(
+        string("argparse::ChoiceArg::applyValue(const StringView &): invalid choice - ") +
+        Value.toString() + " (choose from " + Allowed + ")"
+    );
+}
+
+void ChoiceArg::build() {
+    if (mChoices.empty()) {
+        throw invalid_argument("argparse::ChoiceArg::build(): no choices");
+    }
+
+    FlagIndex Names;
+    for (const Choice &Item: mChoices) {
+        if (Names.find(Item.Name) != FlagIndex::NOT_FOUND) {
+            throw invalid_argument("argparse::ChoiceArg::build(): duplicate choice - " + Item.Name);
+        }
+        Names.insert(Item.Name, 0);
+    }
+
+    // Load factor is kept at most 0.8, so the last buckets still find free slots quickly
+    size_t SlotsCount = 1;
+    while (SlotsCount < mChoices.size() + mChoices.size() / 4) SlotsCount <<= 1;
+
+    mSeeds.assign((mChoices.size() + 3) / 4, 0);
+    vector<uint64_t> Hashes(mChoices.size());
+    for (mSalt = 0;; ++mSalt) {
+        if (mSalt != 0 && mSalt % SALTS_PER_SIZE == 0) SlotsCount <<= 1;
+        mSlots.assign(SlotsCount, NOT_FOUND);
+
+        for (size_t i = 0; i < mChoices.size(); ++i) Hashes[i] = hashName(mChoices[i].Name, mSalt);
+        if (place(Hashes, mSeeds, mSlots)) return;
+    }
+}
+
+void ChoiceArg::selfCopy(const ChoiceArg &Other) {
+    mOutput       = Other.mOutput;
+    mStore        = Other.mStore;
+    mStoreValue   = Other.mStoreValue;
+    mDefaultValue = Other.mDefaultValue;
+    mChoices      = Other.mChoices;
+    mSeeds        = Other.mSeeds;
+    mSlots        = Other.mSlots;
+    mSalt         = Other.mSalt;
+}
+
+void ChoiceArg::selfMove(ChoiceArg &&Other) noexcept {
+    mOutput       = exchange_basic(Other.mOutput, nullptr);
+    mStore        = Other.mStore;
+    mStoreValue   = Other.mStoreValue;
+    mDefaultValue = Other.mDefaultValue;
+    mChoices      = move(Other.mChoices);
+    mSeeds        = move(Other.mSeeds);
+    mSlots        = move(Other.mSlots);
+    mSalt         = Other.mSalt;
+}
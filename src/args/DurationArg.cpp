@@ -0,0 +1,219 @@
+/**
+ * @file DurationArg.cpp
+ * @brief Definition of duration CLI argument
+ *
+ * @version 1.0.0
+ * @authors Eugene Azimut
+ * @copyright Copyright (c) Eugene Azimut, 2026
+ */
+#include <argparse/args/DurationArg.hpp>
+#include <argparse/helpers.hpp>
+#include "args/conversion.hpp"
+
+#include <stdexcept>
+
+using namespace std;
+using namespace argparse;
+using namespace argparse::args;
+using namespace argparse::detail;
+
+
+
+namespace {
+    /**
+     * @struct Unit
+     * @brief Duration unit and its multiplier
+     */
+    struct Unit {
+        const char *Name;           ///< Name
+        uint64_t    Nanoseconds;    ///< Multiplier
+    };
+
+    const uint64_t Microsecond = UINT64_C(1000);
+    const uint64_t Millisecond = Microsecond * 1000;
+    const uint64_t Second      = Millisecond * 1000;
+    const uint64_t Minute      = Second * 60;
+    const uint64_t Hour        = Minute * 60;
+    const uint64_t Day         = Hour * 24;
+
+    const Unit Units[] = {
+        {"ns", 1},
+        {"us", Microsecond}, {"\xC2\xB5s", Microsecond},
+        {"ms", Millisecond},
+        {"s",  Second},
+        {"m",  Minute},
+        {"h",  Hour},
+        {"d",  Day}
+    };
+
+    /**
+     * @brief Signature of DurationArg::applyValue(const StringView &) for error messages
+     */
+    const char *const APPLY_VALUE = "argparse::DurationArg::applyValue(const StringView &)";
+
+    /**
+     * @brief Converts Value into number of nanoseconds
+     * @details Single pass over components "<number><unit>"
+     */
+    Conversion parseDuration(const StringView &Value, uint64_t &Result) {
+        if (Value == "0") {
+            Result = 0;
+            return CONVERTED;
+        }
+        if (Value.empty()) return INVALID;
+
+        uint64_t Total = 0;
+        bool Overflow = false;
+        size_t i = 0;
+        while (i < Value.size()) {
+            const size_t IntegerBegin = i;
+            while (i < Value.size() && Value[i] >= '0' && Value[i] <= '9') ++i;
+            const StringView Integer = Value.substr(IntegerBegin, i - IntegerBegin);
+
+            StringView Fraction;
+            if (i < Value.size() && Value[i] == '.') {
+                const size_t FractionBegin = ++i;
+                while (i < Value.size() && Value[i] >= '0' && Value[i] <= '9') ++i;
+                Fraction = Value.substr(FractionBegin, i - FractionBegin);
+            }
+            if (Integer.empty() && Fraction.empty()) return INVALID;
+
+            const size_t NameBegin = i;
+            while (i < Value.size() && (Value[i] < '0' || Value[i] > '9') && Value[i] != '.') ++i;
+            const StringView Name = Value.substr(NameBegin, i - NameBegin);
+
+            const Unit *Found = nullptr;
+            for (const Unit &Candidate: Units) {
+                if (Name == Candidate.Name) {
+                    Found = &Candidate;
+                    break;
+                }
+            }
+            if (!Found) return UNKNOWN_UNIT;
+
+            // Keep validating the rest after overflow: "600000d5x" is invalid, not out of range
+            uint64_t Component = 0;
+            if (!scale(Integer, Fraction, Found->Nanoseconds, Component) || Total > UINT64_MAX - Component) {
+                Overflow = true;
+            } else {
+                Total += Component;
+            }
+        }
+
+        if (Overflow) return OUT_OF_RANGE;
+        Result = Total;
+        return CONVERTED;
+    }
+}
+
+
+
+DurationArg::DurationArg(
+    uint64_t &Output,
+    const Flags &Flags, const string &Help,
+    uint32_t NArgs,
+    bool IsRequired, bool IsDeprecated,
+    uint64_t StoreValue, uint64_t DefaultValue):
+IOptionalArgument(Flags, Help, NARGS::NO_MORE, IsRequired, IsDeprecated),
+mOutput(&Output),
+mStoreValue(StoreValue), mDefaultValue(DefaultValue) {
+    setNArgs(NArgs);
+}
+
+DurationArg::DurationArg(
+    uint64_t &Output,
+    Flags &&Flags, const string &Help,
+    uint32_t NArgs,
+    bool IsRequired, bool IsDeprecated,
+    uint64_t StoreValue, uint64_t DefaultValue):
+IOptionalArgument(move(Flags), Help, NARGS::NO_MORE, IsRequired, IsDeprecated),
+mOutput(&Output),
+mStoreValue(StoreValue), mDefaultValue(DefaultValue) {
+    setNArgs(NArgs);
+}
+
+DurationArg::DurationArg(const DurationArg &Other):
+IOptionalArgument(Other) {
+    selfCopy(Other);
+}
+
+DurationArg::DurationArg(DurationArg &&Other) noexcept:
+IOptionalArgument(move(Other)) {
+    selfMove(move(Other));
+}
+
+DurationArg::~DurationArg() noexcept {
+    mOutput = nullptr;
+}
+
+void DurationArg::setNArgs(uint32_t NArgs) {
+    if (NArgs == 1 || NArgs == NARGS::ZERO_OR_ONE) {
+        IOptionalArgument::setNArgs(NArgs);
+    } else {
+        throw invalid_argument(
+            string("argparse::DurationArg::setNArgs(uint32_t): invalid NArgs value - ") +
+            to_string(NArgs)
+        );
+    }
+}
+
+uint64_t *DurationArg::getOutput() const {
+    return mOutput;
+}
+
+uint64_t DurationArg::getStoreValue() const {
+    return mStoreValue;
+}
+
+void DurationArg::setStoreValue(uint64_t Value) {
+    mStoreValue = Value;
+}
+
+uint64_t DurationArg::getDefaultValue() const {
+    return mDefaultValue;
+}
+
+void DurationArg::setDefaultValue(uint64_t Value) {
+    mDefaultValue = Value;
+}
+
+void DurationArg::applyDefault() {
+    *mOutput = mDefaultValue;
+}
+
+void DurationArg::applyFlag() {
+    *mOutput = mStoreValue;
+}
+
+ErrorCode DurationArg::validateValue(const StringView &Value) const noexcept {
+    uint64_t Converted = 0;
+    return toErrorCode(parseDuration(Value, Converted));
+}
+
+void DurationArg::applyValue(const StringView &Value) {
+    uint64_t Converted = 0;
+    switch (parseDuration(Value, Converted)) {
+        case INVALID:
+            throw runtime_error(valueError(APPLY_VALUE, "invalid duration", Value));
+        case UNKNOWN_UNIT:
+            throw runtime_error(valueError(APPLY_VALUE, "missing or unknown duration unit", Value));
+        case OUT_OF_RANGE:
+            throw runtime_error(valueError(APPLY_VALUE, "duration doesn't fit 64 bits", Value));
+        case CONVERTED:
+            break;
+    }
+
+    *mOutput = Converted;
+}
+
+void DurationArg::selfCopy(const DurationArg &Other) {
+    mOutput       = Other.mOutput;
+    mStoreValue   = Other.mStoreValue;
+    mDefaultValue = Other.mDefaultValue;
+}
+
+void DurationArg::selfMove(DurationArg &&Other) noexcept {
+    mOutput       = exchange_basic(Other.mOutput, nullptr);
+    mStoreValue   = Other.mStoreValue;
+    mDefaultValue = Other.mDefaultValue;
+}
@@ -9,6 +9,8 @@
 #include <argparse/args/IArgument.hpp>
 #include "argparse/helpers.hpp"
 
+#include <stdexcept>
+
 using namespace std;
 using namespace argparse;
 using namespace argparse::args;
@@ -21,7 +23,8 @@ IArgument::IArgument(
     bool IsRequired, bool IsDeprecated):
 mHelp(""),
 mNArgs(NARGS::NO_MORE),
-mIsRequired(false), mIsDeprecated(false) {
+mIsRequired(false), mIsDeprecated(false),
+mEnvVar(), mRequires(), mImplies(), mRevision(0) {
     setHelp(Help);
     setNArgs(NArgs);
     setRequired(IsRequired);
@@ -44,6 +47,7 @@ const char *IArgument::getHelp() const {
 
 void IArgument::setHelp(const string &Help) {
     mHelp = Help;
+    touch();
 }
 
 uint32_t IArgument::getNArgs() const {
@@ -51,7 +55,13 @@ uint32_t IArgument::getNArgs() const {
 }
 
 void IArgument::setNArgs(uint32_t NArgs) {
+    if (NArgs == NARGS::NO_MORE && !mEnvVar.empty()) {
+        throw invalid_argument(
+            "argparse::IArgument::setNArgs(uint32_t): argument with environment variable must accept values - " + mEnvVar
+        );
+    }
     mNArgs = NArgs;
+    touch();
 }
 
 bool IArgument::isRequired() const {
@@ -60,6 +70,7 @@ bool IArgument::isRequired() const {
 
 void IArgument::setRequired(bool IsRequired) {
     mIsRequired = IsRequired;
+    touch();
 }
 
 bool IArgument::isDeprecated() const {
@@ -68,6 +79,60 @@ bool IArgument::isDeprecated() const {
 
 void IArgument::setDeprecated(bool IsDeprecated) {
     mIsDeprecated = IsDeprecated;
+    touch();
+}
+
+const string &IArgument::getEnvVar() const {
+    return mEnvVar;
+}
+
+void IArgument::setEnvVar(const string &Name) {
+    // Presence of a variable can't be told from a forgotten one: "APP_VERBOSE=0" would turn verbosity on
+    if (!Name.empty() && mNArgs == NARGS::NO_MORE) {
+        throw invalid_argument(
+            "argparse::IArgument::setEnvVar(const std::string &): argument doesn't accept values - " + Name
+        );
+    }
+    mEnvVar = Name;
+    touch();
+}
+
+const vector<string> &IArgument::getRequires() const {
+    return mRequires;
+}
+
+void IArgument::addRequires(const string &Flag) {
+    mRequires.push_back(Flag);
+    touch();
+}
+
+const vector<string> &IArgument::getImplies() const {
+    return mImplies;
+}
+
+void IArgument::addImplies(const string &Flag) {
+    mImplies.push_back(Flag);
+    touch();
+}
+
+uint64_t IArgument::getRevision() const {
+    return mRevision;
+}
+
+void IArgument::applyDefault() {}
+
+void IArgument::reserveValues(uint32_t) {}
+
+void IArgument::applyFlag() {}
+
+ErrorCode IArgument::validateValue(const StringView &) const noexcept {
+    return SUCCESS;
+}
+
+void IArgument::applyValue(const StringView &) {}
+
+void IArgument::touch() {
+    ++mRevision;
 }
 
 void IArgument::selfCopy(const IArgument &Other) {
@@ -75,6 +140,10 @@ void IArgument::selfCopy(const IArgument &Other) {
     mNArgs = Other.mNArgs;
     mIsRequired   = Other.mIsRequired;
     mIsDeprecated = Other.mIsDeprecated;
+    mEnvVar       = Other.mEnvVar;
+    mRequires     = Other.mRequires;
+    mImplies      = Other.mImplies;
+    mRevision     = Other.mRevision;
 }
 
 void IArgument::selfMove(IArgument &&Other) noexcept {
@@ -82,4 +151,8 @@ void IArgument::selfMove(IArgument &&Other) noexcept {
     mNArgs = exchange_basic(Other.mNArgs, NARGS::NO_MORE);
     mIsRequired   = exchange_basic(Other.mIsRequired, false);
     mIsDeprecated = exchange_basic(Other.mIsDeprecated, false);
+    mEnvVar       = move(Other.mEnvVar);
+    mRequires     = move(Other.mRequires);
+    mImplies      = move(Other.mImplies);
+    mRevision     = exchange_basic(Other.mRevision, 0);
 }
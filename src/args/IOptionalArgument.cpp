@@ -21,7 +21,7 @@ IOptionalArgument::IOptionalArgument(
     uint32_t NArgs,
     bool IsRequired, bool IsDeprecated):
 IArgument(Help, NArgs, IsRequired, IsDeprecated),
-mFlags() {
+mFlags(), mMetavar() {
     setFlags(FlagsList);
 }
 
@@ -31,7 +31,7 @@ IOptionalArgument::IOptionalArgument(
     uint32_t NArgs,
     bool IsRequired, bool IsDeprecated):
 IArgument(Help, NArgs, IsRequired, IsDeprecated),
-mFlags() {
+mFlags(), mMetavar() {
     setFlags(move(FlagsList));
 }
 
@@ -53,16 +53,29 @@ const Flags &IOptionalArgument::getFlags() const {
 
 void IOptionalArgument::setFlags(const Flags &FlagsList) {
     mFlags = FlagsList;
+    touch();
 }
 
 void IOptionalArgument::setFlags(Flags &&FlagsList) {
     mFlags = move(FlagsList);
+    touch();
+}
+
+const string &IOptionalArgument::getMetavar() const {
+    return mMetavar;
+}
+
+void IOptionalArgument::setMetavar(const string &Metavar) {
+    mMetavar = Metavar;
+    touch();
 }
 
 void IOptionalArgument::selfCopy(const IOptionalArgument &Other) {
-    mFlags = Other.mFlags;
+    mFlags   = Other.mFlags;
+    mMetavar = Other.mMetavar;
 }
 
 void IOptionalArgument::selfMove(IOptionalArgument &&Other) noexcept {
-    mFlags = move(Other.mFlags);
+    mFlags   = move(Other.mFlags);
+    mMetavar = move(Other.mMetavar);
 }
@@ -0,0 +1,215 @@
+/**
+ * @file ListArg.cpp
+ * @brief Definition of list CLI argument
+ *
+ * @version 1.0.0
+ * @authors Eugene Azimut
+ * @copyright Copyright (c) Eugene Azimut, 2026
+ */
+#include <argparse/args/ListArg.hpp>
+#include <argparse/helpers.hpp>
+#include "simd.hpp"
+
+#include <algorithm>
+#include <stdexcept>
+
+using namespace std;
+using namespace argparse;
+using namespace argparse::args;
+using argparse::detail::bitsCount;
+using argparse::detail::lowestBit;
+
+
+
+namespace {
+#if defined(ARGPARSE_USE_AVX2) || defined(ARGPARSE_USE_SSE2)
+    #if defined(ARGPARSE_USE_AVX2)
+    constexpr size_t CHUNK_SIZE = 32;   ///< Bytes compared at once
+
+    /**
+     * @brief Compares unaligned chunk with Char
+     * @return Bit per byte equal to Char
+     */
+    uint32_t compareChunk(const char *Chunk, char Char) {
+        const __m256i Data = _mm256_loadu_si256(reinterpret_cast<const __m256i *>(Chunk));
+        return static_cast<uint32_t>(_mm256_movemask_epi8(_mm256_cmpeq_epi8(Data, _mm256_set1_epi8(Char))));
+    }
+    #else
+    constexpr size_t CHUNK_SIZE = 16;   ///< Bytes compared at once
+
+    /**
+     * @brief Compares unaligned chunk with Char
+     * @return Bit per byte equal to Char
+     */
+    uint32_t compareChunk(const char *Chunk, char Char) {
+        const __m128i Data = _mm_loadu_si128(reinterpret_cast<const __m128i *>(Chunk));
+        return static_cast<uint32_t>(_mm_movemask_epi8(_mm_cmpeq_epi8(Data, _mm_set1_epi8(Char))));
+    }
+    #endif
+#endif
+
+    /**
+     * @brief Counts Char in Data
+     * @details Vector version never reads past Data + Size: the tail is counted by scalar code
+     */
+    size_t countChar(const char *Data, size_t Size, char Char) {
+        size_t Count = 0;
+        size_t i = 0;
+    #if defined(ARGPARSE_USE_AVX2) || defined(ARGPARSE_USE_SSE2)
+        for (; i + CHUNK_SIZE <= Size; i += CHUNK_SIZE) {
+            Count += bitsCount(compareChunk(Data + i, Char));
+        }
+    #endif
+        for (; i < Size; ++i) {
+            Count += Data[i] == Char;
+        }
+        return Count;
+    }
+
+    /**
+     * @brief Finds the first Char in Data
+     * @return Offset of Char or Size if there is none
+     */
+    size_t findChar(const char *Data, size_t Size, char Char) {
+        size_t i = 0;
+    #if defined(ARGPARSE_USE_AVX2) || defined(ARGPARSE_USE_SSE2)
+        for (; i + CHUNK_SIZE <= Size; i += CHUNK_SIZE) {
+            const uint32_t Mask = compareChunk(Data + i, Char);
+            if (Mask) return i + lowestBit(Mask);
+        }
+    #endif
+        for (; i < Size; ++i) {
+            if (Data[i] == Char) return i;
+        }
+        return Size;
+    }
+
+    /**
+     * @brief Makes room for Count more items keeping amortized growth
+     */
+    void grow(vector<string> &Items, size_t Count) {
+        const size_t Required = Items.size() + Count;
+        if (Required > Items.capacity()) Items.reserve(max(Required, Items.capacity() * 2));
+    }
+}
+
+
+
+ListArg::ListArg(
+    vector<string> &Output,
+    const Flags &Flags, const string &Help,
+    uint32_t NArgs,
+    bool IsRequired, bool IsDeprecated,
+    char Delimiter, const vector<string> &DefaultValue):
+IOptionalArgument(Flags, Help, NARGS::NO_MORE, IsRequired, IsDeprecated),
+mOutput(&Output),
+mDefaultValue(DefaultValue), mDelimiter(Delimiter), mIsDefault(false) {
+    setNArgs(NArgs);
+}
+
+ListArg::ListArg(
+    vector<string> &Output,
+    Flags &&Flags, const string &Help,
+    uint32_t NArgs,
+    bool IsRequired, bool IsDeprecated,
+    char Delimiter, const vector<string> &DefaultValue):
+IOptionalArgument(move(Flags), Help, NARGS::NO_MORE, IsRequired, IsDeprecated),
+mOutput(&Output),
+mDefaultValue(DefaultValue), mDelimiter(Delimiter), mIsDefault(false) {
+    setNArgs(NArgs);
+}
+
+ListArg::ListArg(const ListArg &Other):
+IOptionalArgument(Other) {
+    selfCopy(Other);
+}
+
+ListArg::ListArg(ListArg &&Other) noexcept:
+IOptionalArgument(move(Other)) {
+    selfMove(move(Other));
+}
+
+ListArg::~ListArg() noexcept {
+    mOutput = nullptr;
+}
+
+void ListArg::setNArgs(uint32_t NArgs) {
+    if (NArgs != NARGS::NO_MORE) {
+        IOptionalArgument::setNArgs(NArgs);
+    } else {
+        throw invalid_argument(
+            string("argparse::ListArg::setNArgs(uint32_t): invalid NArgs value - ") +
+            to_string(NArgs)
+        );
+    }
+}
+
+vector<string> *ListArg::getOutput() const {
+    return mOutput;
+}
+
+char ListArg::getDelimiter() const {
+    return mDelimiter;
+}
+
+void ListArg::setDelimiter(char Delimiter) {
+    mDelimiter = Delimiter;
+}
+
+const vector<string> &ListArg::getDefaultValue() const {
+    return mDefaultValue;
+}
+
+void ListArg::setDefaultValue(const vector<string> &Value) {
+    mDefaultValue = Value;
+}
+
+void ListArg::applyDefault() {
+    *mOutput = mDefaultValue;
+    mIsDefault = true;
+}
+
+void ListArg::reserveValues(uint32_t Count) {
+    applyFlag();
+    grow(*mOutput, Count);
+}
+
+void ListArg::applyFlag() {
+    if (mIsDefault) {
+        mOutput->clear();
+        mIsDefault = false;
+    }
+}
+
+void ListArg::applyValue(const StringView &Value) {
+    applyFlag();
+
+    if (mDelimiter == '\0') {
+        mOutput->emplace_back(Value.data(), Value.size());
+        return;
+    }
+
+    grow(*mOutput, countChar(Value.data(), Value.size(), mDelimiter) + 1);
+    for (size_t Begin = 0;;) {
+        const size_t Size = findChar(Value.data() + Begin, Value.size() - Begin, mDelimiter);
+        mOutput->emplace_back(Value.data() + Begin, Size);
+
+        Begin += Size;
+        if (Begin == Value.size()) break;
+        ++Begin;
+    }
+}
+
+void ListArg::selfCopy(const ListArg &Other) {
+    mOutput       = Other.mOutput;
+    mDefaultValue = Other.mDefaultValue;
+    mDelimiter    = Other.mDelimiter;
+    mIsDefault    = Other.mIsDefault;
+}
+
+void ListArg::selfMove(ListArg &&Other) noexcept {
+    mOutput       = exchange_basic(Other.mOutput, nullptr);
+    mDefaultValue = move(Other.mDefaultValue);
+    mDelimiter    = Other.mDelimiter;
+    mIsDefault    = Other.mIsDefault;
+}
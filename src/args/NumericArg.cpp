@@ -0,0 +1,455 @@
+/**
+ * @file NumericArg.cpp
+ * @brief Definition of numeric CLI arguments
+ *
+ * @version 1.0.0
+ * @authors Eugene Azimut
+ * @copyright Copyright (c) Eugene Azimut, 2026
+ */
+#include <argparse/args/NumericArg.hpp>
+#include <argparse/helpers.hpp>
+#include "args/conversion.hpp"
+
+#include <cerrno>
+#include <clocale>
+#include <cmath>
+#include <cstdint>
+#include <cstdlib>
+#include <limits>
+
+using namespace std;
+using namespace argparse;
+using namespace argparse::args;
+using namespace argparse::detail;
+
+
+
+namespace {
+    /**
+     * @brief Signature of NumericArg::applyValue(const StringView &) for error messages
+     */
+    const char *const APPLY_VALUE = "argparse::NumericArg::applyValue(const StringView &)";
+
+    /**
+     * @brief Returns value of hexadecimal or decimal digit or 16 for other characters
+     */
+    unsigned digitValue(char Char) {
+        if (Char >= '0' && Char <= '9') return static_cast<unsigned>(Char - '0');
+        if (Char >= 'a' && Char <= 'f') return static_cast<unsigned>(Char - 'a' + 10);
+        if (Char >= 'A' && Char <= 'F') return static_cast<unsigned>(Char - 'A' + 10);
+        return 16;
+    }
+
+    /**
+     * @brief Converts decimal or hexadecimal digits into magnitude
+     * @param[in] Digits Digits without sign, e.g. "42" or "0xff"
+     * @param[out] Magnitude Converted value
+     * @return CONVERTED, INVALID or OUT_OF_RANGE if the value exceeds 64 bits
+     */
+    Conversion parseMagnitude(const StringView &Digits, uint64_t &Magnitude) {
+        unsigned Base = 10;
+        size_t i = 0;
+        if (Digits.size() > 2 && Digits[0] == '0' && (Digits[1] == 'x' || Digits[1] == 'X')) {
+            Base = 16;
+            i = 2;
+        }
+        if (i == Digits.size()) return INVALID;
+
+        uint64_t Result = 0;
+        bool Overflow = false;
+        for (; i < Digits.size(); ++i) {
+            const unsigned Digit = digitValue(Digits[i]);
+            if (Digit >= Base) return INVALID;
+
+            // Keep validating the rest after overflow: "99999999999999999999x" is invalid, not out of range
+            if (Result > (UINT64_MAX - Digit) / Base) Overflow = true;
+            Result = Result * Base + Digit;
+        }
+
+        if (Overflow) return OUT_OF_RANGE;
+        Magnitude = Result;
+        return CONVERTED;
+    }
+
+    /**
+     * @brief Converts Value into integer type T
+     */
+    template<typename T>
+    Conversion parseInteger(const StringView &Value, T &Result) {
+        bool IsNegative = false;
+        StringView Digits = Value;
+        if (!Digits.empty() && (Digits[0] == '-' || Digits[0] == '+')) {
+            IsNegative = Digits[0] == '-';
+            Digits = Digits.substr(1);
+        }
+
+        uint64_t Magnitude = 0;
+        const Conversion Status = parseMagnitude(Digits, Magnitude);
+        if (Status != CONVERTED) return Status;
+
+        if (IsNegative && !is_signed<T>::value) {
+            // "-0" is the only negative number fitting unsigned types
+            if (Magnitude != 0) return OUT_OF_RANGE;
+            Result = 0;
+            return CONVERTED;
+        }
+
+        const uint64_t Max = static_cast<uint64_t>(numeric_limits<T>::max());
+        if (!IsNegative) {
+            if (Magnitude > Max) return OUT_OF_RANGE;
+            Result = static_cast<T>(Magnitude);
+            return CONVERTED;
+        }
+
+        // |min| of a signed type is max + 1
+        if (Magnitude > Max + 1) return OUT_OF_RANGE;
+        Result = Magnitude == Max + 1 ? numeric_limits<T>::min() : static_cast<T>(-static_cast<T>(Magnitude));
+        return CONVERTED;
+    }
+
+    /**
+     * @brief Converts Value into double
+     * @details Syntax is validated first. Then Clinger's fast path is taken:
+     * when the decimal significand fits 53 bits and the decimal exponent is within [-22, 22]
+     * both are exact doubles, and one correctly rounded multiplication or division gives
+     * the correctly rounded result. Other values are converted by strtod from a stack copy
+     * with the decimal point of the current locale
+     */
+    Conversion parseDouble(const StringView &Value, double &Result) {
+        static const double Powers[] = {
+            1e0,  1e1,  1e2,  1e3,  1e4,  1e5,  1e6,  1e7,  1e8,  1e9,  1e10, 1e11,
+            1e12, 1e13, 1e14, 1e15, 1e16, 1e17, 1e18, 1e19, 1e20, 1e21, 1e22
+        };
+
+        size_t i = 0;
+        bool IsNegative = false;
+        if (i < Value.size() && (Value[i] == '-' || Value[i] == '+')) {
+            IsNegative = Value[i] == '-';
+            ++i;
+        }
+
+        //* Special values
+        const StringView Rest = Value.substr(i);
+        if (equalsNoCase(Rest, "inf") || equalsNoCase(Rest, "infinity")) {
+            Result = IsNegative ? -numeric_limits<double>::infinity() : numeric_limits<double>::infinity();
+            return CONVERTED;
+        }
+        if (equalsNoCase(Rest, "nan")) {
+            Result = numeric_limits<double>::quiet_NaN();
+            return CONVERTED;
+        }
+
+        //* Significand
+        uint64_t Significand = 0;
+        int SignificantDigits = 0;      // Digits accumulated into Significand
+        int DroppedDigits = 0;          // Integer digits which didn't fit Significand
+        int FractionDigits = 0;         // Fraction digits accumulated into Significand
+        bool HasDigits = false;
+        bool IsInexact = false;         // Some non-zero digits didn't fit Significand
+
+        for (; i < Value.size() && Value[i] >= '0' && Value[i] <= '9'; ++i) {
+            HasDigits = true;
+            if (SignificantDigits < 19) {
+                Significand = Significand * 10 + static_cast<uint64_t>(Value[i] - '0');
+                if (Significand) ++SignificantDigits;
+            } else {
+                ++DroppedDigits;
+                IsInexact |= Value[i] != '0';
+            }
+        }
+        if (i < Value.size() && Value[i] == '.') {
+            for (++i; i < Value.size() && Value[i] >= '0' && Value[i] <= '9'; ++i) {
+                HasDigits = true;
+                if (SignificantDigits < 19) {
+                    Significand = Significand * 10 + static_cast<uint64_t>(Value[i] - '0');
+                    if (Significand) ++SignificantDigits;
+                    ++FractionDigits;
+                } else {
+                    IsInexact |= Value[i] != '0';
+                }
+            }
+        }
+        if (!HasDigits) return INVALID;
+
+        //* Exponent
+        long Exponent = 0;
+        if (i < Value.size() && (Value[i] == 'e' || Value[i] == 'E')) {
+            ++i;
+            bool IsExpNegative = false;
+            if (i < Value.size() && (Value[i] == '-' || Value[i] == '+')) {
+                IsExpNegative = Value[i] == '-';
+                ++i;
+            }
+            if (i == Value.size()) return INVALID;
+            for (; i < Value.size() && Value[i] >= '0' && Value[i] <= '9'; ++i) {
+                // Saturate: such exponents are out of range anyway
+                if (Exponent < 100000) Exponent = Exponent * 10 + (Value[i] - '0');
+            }
+            if (IsExpNegative) Exponent = -Exponent;
+        }
+        if (i != Value.size()) return INVALID;
+
+        //* Fast path
+        const long Exp10 = Exponent + DroppedDigits - FractionDigits;
+        if (!IsInexact && Significand <= (UINT64_C(1) << 53) && Exp10 >= -22 && Exp10 <= 22) {
+            double Magnitude = static_cast<double>(Significand);
+            Magnitude = Exp10 < 0 ? Magnitude / Powers[-Exp10] : Magnitude * Powers[Exp10];
+            Result = IsNegative ? -Magnitude : Magnitude;
+            return CONVERTED;
+        }
+        if (Significand == 0 && !IsInexact) {
+            Result = IsNegative ? -0.0 : 0.0;
+            return CONVERTED;
+        }
+
+        //* Slow path
+        char Buffer[512];
+        if (Value.size() >= sizeof(Buffer)) return OUT_OF_RANGE;
+
+        const char DecimalPoint = localeconv()->decimal_point[0];
+        for (size_t j = 0; j < Value.size(); ++j) {
+            Buffer[j] = Value[j] == '.' ? DecimalPoint : Value[j];
+        }
+        Buffer[Value.size()] = '\0';
+
+        errno = 0;
+        char *End = nullptr;
+        const double Converted = strtod(Buffer, &End);
+        if (End != Buffer + Value.size()) return INVALID;
+        if (errno == ERANGE && (std::isinf(Converted) || Converted == 0.0)) return OUT_OF_RANGE;
+
+        Result = Converted;
+        return CONVERTED;
+    }
+
+    /**
+     * @brief Converts Value into T
+     */
+    template<typename T>
+    Conversion parseNumber(const StringView &Value, T &Result, true_type /* IsInteger */) {
+        return parseInteger(Value, Result);
+    }
+
+    template<typename T>
+    Conversion parseNumber(const StringView &Value, T &Result, false_type /* IsInteger */) {
+        double Converted = 0;
+        const Conversion Status = parseDouble(Value, Converted);
+        if (Status != CONVERTED) return Status;
+
+        if (std::isfinite(Converted) && std::fabs(Converted) > static_cast<double>(numeric_limits<T>::max())) {
+            return OUT_OF_RANGE;
+        }
+
+        const T Narrowed = static_cast<T>(Converted);
+        if (Narrowed == 0 && Converted != 0) {
+            // Underflow
+            return OUT_OF_RANGE;
+        }
+        Result = Narrowed;
+        return CONVERTED;
+    }
+
+    /**
+     * @brief Converts Value into T and checks it against [Min, Max]
+     * @param[out] Status Result of conversion. Tells numbers not fitting T from numbers outside of [Min, Max]
+     */
+    template<typename T>
+    ErrorCode convertNumber(const StringView &Value, T Min, T Max, T &Result, Conversion &Status) noexcept {
+        Status = parseNumber(Value, Result, integral_constant<bool, is_integral<T>::value>());
+        if (Status != CONVERTED) return toErrorCode(Status);
+        return Result < Min || Result > Max ? VALUE_OUT_OF_RANGE : SUCCESS;
+    }
+
+    /**
+     * @brief Returns the lowest value of T. -infinity for floating-point types
+     */
+    template<typename T>
+    T lowestOf() {
+        return numeric_limits<T>::has_infinity ? -numeric_limits<T>::infinity() : numeric_limits<T>::lowest();
+    }
+
+    /**
+     * @brief Returns the highest value of T. +infinity for floating-point types
+     */
+    template<typename T>
+    T highestOf() {
+        return numeric_limits<T>::has_infinity ? numeric_limits<T>::infinity() : numeric_limits<T>::max();
+    }
+}
+
+
+
+template<typename T>
+NumericArg<T>::NumericArg(
+    T &Output,
+    const Flags &Flags, const string &Help,
+    uint32_t NArgs,
+    bool IsRequired, bool IsDeprecated,
+    T StoreValue, T DefaultValue):
+IOptionalArgument(Flags, Help, NARGS::NO_MORE, IsRequired, IsDeprecated),
+mOutput(&Output),
+mStoreValue(StoreValue), mDefaultValue(DefaultValue),
+mMin(lowestOf<T>()), mMax(highestOf<T>()) {
+    setNArgs(NArgs);
+}
+
+template<typename T>
+NumericArg<T>::NumericArg(
+    T &Output,
+    Flags &&Flags, const string &Help,
+    uint32_t NArgs,
+    bool IsRequired, bool IsDeprecated,
+    T StoreValue, T DefaultValue):
+IOptionalArgument(move(Flags), Help, NARGS::NO_MORE, IsRequired, IsDeprecated),
+mOutput(&Output),
+mStoreValue(StoreValue), mDefaultValue(DefaultValue),
+mMin(lowestOf<T>()), mMax(highestOf<T>()) {
+    setNArgs(NArgs);
+}
+
+template<typename T>
+NumericArg<T>::NumericArg(const NumericArg &Other):
+IOptionalArgument(Other) {
+    selfCopy(Other);
+}
+
+template<typename T>
+NumericArg<T>::NumericArg(NumericArg &&Other) noexcept:
+IOptionalArgument(move(Other)) {
+    selfMove(move(Other));
+}
+
+template<typename T>
+NumericArg<T>::~NumericArg() noexcept {
+    mOutput = nullptr;
+}
+
+template<typename T>
+void NumericArg<T>::setNArgs(uint32_t NArgs) {
+    if (NArgs == 1 || NArgs == NARGS::ZERO_OR_ONE) {
+        IOptionalArgument::setNArgs(NArgs);
+    } else {
+        throw invalid_argument(
+            string("argparse::NumericArg::setNArgs(uint32_t): invalid NArgs value - ") +
+            to_string(NArgs)
+        );
+    }
+}
+
+template<typename T>
+T *NumericArg<T>::getOutput() const {
+    return mOutput;
+}
+
+template<typename T>
+T NumericArg<T>::getStoreValue() const {
+    return mStoreValue;
+}
+
+template<typename T>
+void NumericArg<T>::setStoreValue(T Value) {
+    mStoreValue = Value;
+}
+
+template<typename T>
+T NumericArg<T>::getDefaultValue() const {
+    return mDefaultValue;
+}
+
+template<typename T>
+void NumericArg<T>::setDefaultValue(T Value) {
+    mDefaultValue = Value;
+}
+
+template<typename T>
+T NumericArg<T>::getMin() const {
+    return mMin;
+}
+
+template<typename T>
+T NumericArg<T>::getMax() const {
+    return mMax;
+}
+
+template<typename T>
+void NumericArg<T>::setRange(T Min, T Max) {
+    if (Min > Max) {
+        throw invalid_argument(
+            string("argparse::NumericArg::setRange(T, T): minimum is greater than maximum - ") +
+            std::to_string(Min) + " > " + std::to_string(Max)
+        );
+    }
+    mMin = Min;
+    mMax = Max;
+}
+
+template<typename T>
+void NumericArg<T>::applyDefault() {
+    *mOutput = mDefaultValue;
+}
+
+template<typename T>
+void NumericArg<T>::applyFlag() {
+    *mOutput = mStoreValue;
+}
+
+template<typename T>
+ErrorCode NumericArg<T>::validateValue(const StringView &Value) const noexcept {
+    T Converted = T();
+    Conversion Status = CONVERTED;
+    return convertNumber(Value, mMin, mMax, Converted, Status);
+}
+
+template<typename T>
+void NumericArg<T>::applyValue(const StringView &Value) {
+    T Converted = T();
+    Conversion Status = CONVERTED;
+    switch (convertNumber(Value, mMin, mMax, Converted, Status)) {
+        case SUCCESS:
+            *mOutput = Converted;
+            return;
+        case INVALID_VALUE:
+            throw runtime_error(valueError(APPLY_VALUE, "invalid number", Value));
+        default:
+            break;
+    }
+
+    if (Status == OUT_OF_RANGE) {
+        throw runtime_error(valueError(APPLY_VALUE, "number doesn't fit the argument type", Value));
+    }
+    if (Converted < mMin) {
+        throw runtime_error(valueError(APPLY_VALUE, ("number is less than " + std::to_string(mMin)).c_str(), Value));
+    }
+    throw runtime_error(valueError(APPLY_VALUE, ("number is greater than " + std::to_string(mMax)).c_str(), Value));
+}
+
+template<typename T>
+void NumericArg<T>::selfCopy(const NumericArg &Other) {
+    mOutput       = Other.mOutput;
+    mStoreValue   = Other.mStoreValue;
+    mDefaultValue = Other.mDefaultValue;
+    mMin          = Other.mMin;
+    mMax          = Other.mMax;
+}
+
+template<typename T>
+void NumericArg<T>::selfMove(NumericArg &&Other) noexcept {
+    mOutput       = exchange_basic(Other.mOutput, nullptr);
+    mStoreValue   = Other.mStoreValue;
+    mDefaultValue = Other.mDefaultValue;
+    mMin          = Other.mMin;
+    mMax          = Other.mMax;
+}
+
+
+
+template class argparse::args::NumericArg<short>;
+template class argparse::args::NumericArg<int>;
+template class argparse::args::NumericArg<long>;
+template class argparse::args::NumericArg<long long>;
+template class argparse::args::NumericArg<unsigned short>;
+template class argparse::args::NumericArg<unsigned int>;
+template class argparse::args::NumericArg<unsigned long>;
+template class argparse::args::NumericArg<unsigned long long>;
+template class argparse::args::NumericArg<float>;
+template class argparse::args::NumericArg<double>;
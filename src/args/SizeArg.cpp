@@ -0,0 +1,197 @@
+/**
+ * @file SizeArg.cpp
+ * @brief Definition of byte size CLI argument
+ *
+ * @version 1.0.0
+ * @authors Eugene Azimut
+ * @copyright Copyright (c) Eugene Azimut, 2026
+ */
+#include <argparse/args/SizeArg.hpp>
+#include <argparse/helpers.hpp>
+#include "args/conversion.hpp"
+
+#include <stdexcept>
+
+using namespace std;
+using namespace argparse;
+using namespace argparse::args;
+using namespace argparse::detail;
+
+
+
+namespace {
+    /**
+     * @struct Unit
+     * @brief Size unit and its multiplier
+     */
+    struct Unit {
+        const char *Name;   ///< Lowercase name
+        uint64_t    Bytes;  ///< Multiplier
+    };
+
+    const uint64_t KiB = UINT64_C(1) << 10;
+    const uint64_t MiB = UINT64_C(1) << 20;
+    const uint64_t GiB = UINT64_C(1) << 30;
+    const uint64_t TiB = UINT64_C(1) << 40;
+    const uint64_t PiB = UINT64_C(1) << 50;
+    const uint64_t EiB = UINT64_C(1) << 60;
+
+    const uint64_t KB = UINT64_C(1000);
+    const uint64_t MB = KB * 1000;
+    const uint64_t GB = MB * 1000;
+    const uint64_t TB = GB * 1000;
+    const uint64_t PB = TB * 1000;
+    const uint64_t EB = PB * 1000;
+
+    const Unit Units[] = {
+        {"",  1},   {"b",   1},
+        {"k", KiB}, {"kib", KiB}, {"kb", KB},
+        {"m", MiB}, {"mib", MiB}, {"mb", MB},
+        {"g", GiB}, {"gib", GiB}, {"gb", GB},
+        {"t", TiB}, {"tib", TiB}, {"tb", TB},
+        {"p", PiB}, {"pib", PiB}, {"pb", PB},
+        {"e", EiB}, {"eib", EiB}, {"eb", EB}
+    };
+
+    /**
+     * @brief Signature of SizeArg::applyValue(const StringView &) for error messages
+     */
+    const char *const APPLY_VALUE = "argparse::SizeArg::applyValue(const StringView &)";
+
+    /**
+     * @brief Converts Value into number of bytes
+     */
+    Conversion parseSize(const StringView &Value, uint64_t &Result) {
+        size_t i = 0;
+        while (i < Value.size() && Value[i] >= '0' && Value[i] <= '9') ++i;
+        const StringView Integer = Value.substr(0, i);
+
+        StringView Fraction;
+        if (i < Value.size() && Value[i] == '.') {
+            const size_t Begin = ++i;
+            while (i < Value.size() && Value[i] >= '0' && Value[i] <= '9') ++i;
+            Fraction = Value.substr(Begin, i - Begin);
+        }
+        if (Integer.empty() && Fraction.empty()) return INVALID;
+
+        const StringView Name = Value.substr(i);
+        for (const Unit &Candidate: Units) {
+            if (equalsNoCase(Name, Candidate.Name)) {
+                return scale(Integer, Fraction, Candidate.Bytes, Result) ? CONVERTED : OUT_OF_RANGE;
+            }
+        }
+        return UNKNOWN_UNIT;
+    }
+}
+
+
+
+SizeArg::SizeArg(
+    uint64_t &Output,
+    const Flags &Flags, const string &Help,
+    uint32_t NArgs,
+    bool IsRequired, bool IsDeprecated,
+    uint64_t StoreValue, uint64_t DefaultValue):
+IOptionalArgument(Flags, Help, NARGS::NO_MORE, IsRequired, IsDeprecated),
+mOutput(&Output),
+mStoreValue(StoreValue), mDefaultValue(DefaultValue) {
+    setNArgs(NArgs);
+}
+
+SizeArg::SizeArg(
+    uint64_t &Output,
+    Flags &&Flags, const string &Help,
+    uint32_t NArgs,
+    bool IsRequired, bool IsDeprecated,
+    uint64_t StoreValue, uint64_t DefaultValue):
+IOptionalArgument(move(Flags), Help, NARGS::NO_MORE, IsRequired, IsDeprecated),
+mOutput(&Output),
+mStoreValue(StoreValue), mDefaultValue(DefaultValue) {
+    setNArgs(NArgs);
+}
+
+SizeArg::SizeArg(const SizeArg &Other):
+IOptionalArgument(Other) {
+    selfCopy(Other);
+}
+
+SizeArg::SizeArg(SizeArg &&Other) noexcept:
+IOptionalArgument(move(Other)) {
+    selfMove(move(Other));
+}
+
+SizeArg::~SizeArg() noexcept {
+    mOutput = nullptr;
+}
+
+void SizeArg::setNArgs(uint32_t NArgs) {
+    if (NArgs == 1 || NArgs == NARGS::ZERO_OR_ONE) {
+        IOptionalArgument::setNArgs(NArgs);
+    } else {
+        throw invalid_argument(
+            string("argparse::SizeArg::setNArgs(uint32_t): invalid NArgs value - ") +
+            to_string(NArgs)
+        );
+    }
+}
+
+uint64_t *SizeArg::getOutput() const {
+    return mOutput;
+}
+
+uint64_t SizeArg::getStoreValue() const {
+    return mStoreValue;
+}
+
+void SizeArg::setStoreValue(uint64_t Value) {
+    mStoreValue = Value;
+}
+
+uint64_t SizeArg::getDefaultValue() const {
+    return mDefaultValue;
+}
+
+void SizeArg::setDefaultValue(uint64_t Value) {
+    mDefaultValue = Value;
+}
+
+void SizeArg::applyDefault() {
+    *mOutput = mDefaultValue;
+}
+
+void SizeArg::applyFlag() {
+    *mOutput = mStoreValue;
+}
+
+ErrorCode SizeArg::validateValue(const StringView &Value) const noexcept {
+    uint64_t Converted = 0;
+    return toErrorCode(parseSize(Value, Converted));
+}
+
+void SizeArg::applyValue(const StringView &Value) {
+    uint64_t Converted = 0;
+    switch (parseSize(Value, Converted)) {
+        case INVALID:
+            throw runtime_error(valueError(APPLY_VALUE, "invalid size", Value));
+        case UNKNOWN_UNIT:
+            throw runtime_error(valueError(APPLY_VALUE, "unknown size unit", Value));
+        case OUT_OF_RANGE:
+            throw runtime_error(valueError(APPLY_VALUE, "size doesn't fit 64 bits", Value));
+        case CONVERTED:
+            break;
+    }
+
+    *mOutput = Converted;
+}
+
+void SizeArg::selfCopy(const SizeArg &Other) {
+    mOutput       = Other.mOutput;
+    mStoreValue   = Other.mStoreValue;
+    mDefaultValue = Other.mDefaultValue;
+}
+
+void SizeArg::selfMove(SizeArg &&Other) noexcept {
+    mOutput       = exchange_basic(Other.mOutput, nullptr);
+    mStoreValue   = Other.mStoreValue;
+    mDefaultValue = Other.mDefaultValue;
+}
@@ -0,0 +1,118 @@
+/**
+ * @file conversion.hpp
+ * @brief Internal helpers shared by value conversions of argument types
+ *
+ * @version 1.0.0
+ * @authors Eugene Azimut
+ * @copyright Copyright (c) Eugene Azimut, 2026
+ */
+#pragma once
+
+#include <argparse/ArgparseError.hpp>
+#include <argparse/StringView.hpp>
+
+#include <cstddef>
+#include <cstdint>
+#include <string>
+
+
+
+namespace argparse {
+    namespace detail {
+        /**
+         * @brief Result of value conversion
+         *
+         * @version 1.0.0
+         * @authors Eugene Azimut
+         */
+        enum Conversion {
+            CONVERTED,      ///< Value was converted
+            INVALID,        ///< Value is malformed
+            UNKNOWN_UNIT,   ///< Unit is missing or isn't supported
+            OUT_OF_RANGE    ///< Value doesn't fit the output type
+        };
+
+        /**
+         * @brief Returns error code of IArgument::validateValue(const StringView &) const for Status
+         *
+         * @version 1.0.0
+         * @authors Eugene Azimut
+         */
+        inline ErrorCode toErrorCode(Conversion Status) noexcept {
+            switch (Status) {
+                case CONVERTED:
+                    return SUCCESS;
+                case OUT_OF_RANGE:
+                    return VALUE_OUT_OF_RANGE;
+                case INVALID:
+                case UNKNOWN_UNIT:
+                    break;
+            }
+            return INVALID_VALUE;
+        }
+
+        /**
+         * @brief Builds error message of applyValue(const StringView &)
+         * @param[in] Method Qualified signature of the throwing method
+         * @param[in] Reason What is wrong with Value
+         * @param[in] Value Rejected value
+         *
+         * @version 1.0.0
+         * @authors Eugene Azimut
+         */
+        inline std::string valueError(const char *Method, const char *Reason, const StringView &Value) {
+            return std::string(Method) + ": " + Reason + " - " + Value.toString();
+        }
+
+        /**
+         * @brief Case-insensitive comparison of Value with lowercase Expected
+         *
+         * @version 1.0.0
+         * @authors Eugene Azimut
+         */
+        inline bool equalsNoCase(const StringView &Value, const char *Expected) {
+            size_t i = 0;
+            for (; i < Value.size() && Expected[i] != '\0'; ++i) {
+                char Char = Value[i];
+                if (Char >= 'A' && Char <= 'Z') Char = static_cast<char>(Char - 'A' + 'a');
+                if (Char != Expected[i]) return false;
+            }
+            return i == Value.size() && Expected[i] == '\0';
+        }
+
+        /**
+         * @brief Computes floor((Integer.Fraction) * Multiplier) exactly
+         * @details The fraction is folded from its last digit:
+         * floor((d * M + floor(x)) / 10) == floor((d * M + x) / 10), so every step
+         * fits 64 bits while Multiplier <= (2^64 - 1) / 10
+         *
+         * @param[in] Integer Decimal digits of integer part
+         * @param[in] Fraction Decimal digits of fraction
+         * @param[in] Multiplier Unit multiplier
+         * @param[out] Result Scaled value
+         * @return false if the value exceeds 64 bits
+         *
+         * @version 1.0.0
+         * @authors Eugene Azimut
+         */
+        inline bool scale(const StringView &Integer, const StringView &Fraction, uint64_t Multiplier, uint64_t &Result) {
+            uint64_t Whole = 0;
+            for (size_t i = 0; i < Integer.size(); ++i) {
+                const uint64_t Digit = static_cast<uint64_t>(Integer[i] - '0');
+                if (Whole > (UINT64_MAX - Digit) / 10) return false;
+                Whole = Whole * 10 + Digit;
+            }
+            if (Whole != 0 && Multiplier > UINT64_MAX / Whole) return false;
+            Whole *= Multiplier;
+
+            uint64_t Part = 0;
+            for (size_t i = Fraction.size(); i-- > 0;) {
+                Part = (static_cast<uint64_t>(Fraction[i] - '0') * Multiplier + Part) / 10;
+            }
+
+            if (Whole > UINT64_MAX - Part) return false;
+            Result = Whole + Part;
+            return true;
+        }
+    }
+}
@@ -0,0 +1,106 @@
+/**
+ * @file simd.hpp
+ * @brief Internal SIMD feature selection and bit helpers
+ * @details The instruction set is chosen at build time: AVX2 if the compiler targets it,
+ * SSE2 otherwise, none if ARGPARSE_NO_SIMD is defined (ARGPARSE_SIMD=NONE in CMake).
+ * Defines ARGPARSE_USE_AVX2 or ARGPARSE_USE_SSE2 accordingly
+ *
+ * @version 1.0.0
+ * @authors Eugene Azimut
+ * @copyright Copyright (c) Eugene Azimut, 2026
+ */
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+
+#if !defined(ARGPARSE_NO_SIMD) && defined(__AVX2__)
+    #include <immintrin.h>
+    #define ARGPARSE_USE_AVX2
+#elif !defined(ARGPARSE_NO_SIMD) && (defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2))
+    #include <emmintrin.h>
+    #define ARGPARSE_USE_SSE2
+#endif
+
+#if defined(_MSC_VER)
+    #include <intrin.h>
+#endif
+
+/** @cond IGNORE */
+#if defined(__GNUC__) || defined(__clang__)
+    // Aligned vector loads may read past the terminator, but never past the page of the terminator
+    #define ARGPARSE_NO_SANITIZE_ADDRESS __attribute__((no_sanitize_address))
+#else
+    #define ARGPARSE_NO_SANITIZE_ADDRESS
+#endif
+/** @endcond */
+
+
+
+namespace argparse {
+    /**
+     * @namespace argparse::detail
+     * @brief Internal helpers of the library
+     *
+     * @version 1.0.0
+     * @authors Eugene Azimut
+     */
+    namespace detail {
+        /**
+         * @brief Returns index of the lowest set bit. Mask must not be 0
+         *
+         * @version 1.0.0
+         * @authors Eugene Azimut
+         */
+        inline size_t lowestBit(uint32_t Mask) {
+        #if defined(_MSC_VER)
+            unsigned long Index;
+            _BitScanForward(&Index, Mask);
+            return Index;
+        #elif defined(__GNUC__) || defined(__clang__)
+            return static_cast<size_t>(__builtin_ctz(Mask));
+        #else
+            size_t Index = 0;
+            for (; !(Mask & 1u); Mask >>= 1) ++Index;
+            return Index;
+        #endif
+        }
+
+        /**
+         * @brief Returns index of the lowest set bit. Mask must not be 0
+         *
+         * @version 1.0.0
+         * @authors Eugene Azimut
+         */
+        inline size_t lowestBit(uint64_t Mask) {
+        #if defined(_MSC_VER) && defined(_M_X64)
+            unsigned long Index;
+            _BitScanForward64(&Index, Mask);
+            return Index;
+        #elif defined(__GNUC__) || defined(__clang__)
+            return static_cast<size_t>(__builtin_ctzll(Mask));
+        #else
+            const uint32_t Low = static_cast<uint32_t>(Mask);
+            return Low ? lowestBit(Low) : 32 + lowestBit(static_cast<uint32_t>(Mask >> 32));
+        #endif
+        }
+
+        /**
+         * @brief Returns number of set bits
+         *
+         * @version 1.0.0
+         * @authors Eugene Azimut
+         */
+        inline size_t bitsCount(uint32_t Mask) {
+        #if defined(_MSC_VER)
+            return __popcnt(Mask);
+        #elif defined(__GNUC__) || defined(__clang__)
+            return static_cast<size_t>(__builtin_popcount(Mask));
+        #else
+            size_t Count = 0;
+            for (; Mask; Mask &= Mask - 1) ++Count;
+            return Count;
+        #endif
+        }
+    }
+}
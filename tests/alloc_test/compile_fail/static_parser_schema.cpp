@@ -0,0 +1,41 @@
+/**
+ * @file static_parser_schema.cpp
+ * @brief Schemas which argparse::StaticParser must reject during compilation
+ * @details Built by ctest, one target per schema:
+ *   * STATIC_SCHEMA_VALID          - control schema, must compile;
+ *   * STATIC_SCHEMA_DUPLICATE_FLAG - two options share a flag, must not compile;
+ *   * STATIC_SCHEMA_INVALID_NARGS  - option consumes 2 values, must not compile
+ *
+ * The control keeps the failing builds honest: they differ from it only by the schema
+ *
+ * @version 1.0.0
+ * @authors Eugene Azimut
+ * @copyright Copyright (c) Eugene Azimut, 2026
+ */
+#include <argparse/StaticParser.hpp>
+
+using namespace argparse;
+using namespace argparse::args;
+
+
+
+namespace {
+    constexpr StaticOption Options[] = {
+        StaticOption("-v", "--verbose"),
+#if defined(STATIC_SCHEMA_DUPLICATE_FLAG)
+        StaticOption("-V", "--verbose")
+#elif defined(STATIC_SCHEMA_INVALID_NARGS)
+        StaticOption("-o", "--output", 2)
+#else
+        StaticOption("-o", "--output", 1)
+#endif
+    };
+
+    constexpr auto Parser = makeStaticParser(Options);
+}
+
+
+
+int main() {
+    return static_cast<int>(Parser.indexOf("--verbose"));
+}
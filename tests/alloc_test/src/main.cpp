@@ -0,0 +1,328 @@
+/**
+ * @file main.cpp
+ * @brief Allocation budgets of libargparse API
+ * @details Global operator new is replaced to count allocations.
+ * Every check runs a piece of API and compares the number of allocations
+ * with its budget:
+ *   * steady-state parsing (views, tokenizing, lookups, repeated parse calls) must not allocate;
+ *   * registration is allowed a small bounded number of allocations per argument
+ *
+ * Behavior is checked by tests/unit_tests. Exit code is the number of failed checks
+ *
+ * @version 1.0.0
+ * @authors Eugene Azimut
+ * @copyright Copyright (c) Eugene Azimut, 2026
+ */
+#include <argparse/argparse.hpp>
+#include <argparse/FlagIndex.hpp>
+#include <argparse/OptionStyles/WindowsStyle.hpp>
+
+#include <test_common/alloc_counter.hpp>
+#include <test_common/checks.hpp>
+
+#include <cstdio>
+#include <string>
+#include <vector>
+
+using namespace std;
+using namespace argparse;
+using namespace argparse::args;
+using namespace argparse::OptStyles;
+
+
+
+/**
+ * @brief Parses with constexpr argparse::StaticParser schema
+ * @details Defined in static_parser.cpp, which is compiled as C++14
+ * @return Whether or not occurrences and values are as expected
+ */
+bool checkStaticParser();
+
+
+
+namespace {
+    using test_common::expectTrue;
+
+    /**
+     * @brief Runs Body and checks that it made at most Budget allocations
+     * @param[in] Name Check name
+     * @param[in] Budget Maximum number of allocations
+     * @param[in] Body Checked code
+     */
+    template<typename Body>
+    void expectAllocs(const char *Name, size_t Budget, Body &&Run) {
+        const size_t Before = AllocationsCount;
+        Run();
+        const size_t Allocs = AllocationsCount - Before;
+
+        const bool Passed = Allocs <= Budget;
+        if (!Passed) ++test_common::failures();
+        printf("[%s] %-52s allocs: %4zu, budget: %4zu\n", Passed ? " OK " : "FAIL", Name, Allocs, Budget);
+    }
+
+    /**
+     * @brief Tokenizes every argument with Style
+     * @return Total size of options to keep the loop alive
+     */
+    size_t tokenizeAll(const OptionStyle &Style, const vector<const char *> &Args) {
+        size_t Size = 0;
+        for (const char *Arg: Args) Size += Style.tokenize(Arg).Option.size();
+        return Size;
+    }
+}
+
+
+
+int main() {
+    //* Views and tokenizing
+    const UnixStyle    Unix;
+    const WindowsStyle Windows;
+    const OptionStyle  Generic("--", "=");
+
+    const vector<const char *> UnixArgs = {
+        "-f", "-fvalue", "--flag", "--flag=value", "--a-very-long-option-name=with-a-long-value", "file", "--"
+    };
+    const vector<const char *> WindowsArgs = {"/f", "/flag:value", "/a-very-long-option-name:with-a-long-value", "file"};
+    const vector<const char *> GenericArgs = {"--f", "--flag=value", "--a-very-long-option-name=with-a-long-value", "file"};
+
+    size_t Sink = 0;
+    expectAllocs("StringView construction and search", 0, [&]() {
+        const StringView View("--a-very-long-option-name=with-a-long-value");
+        Sink += View.find('=') + View.find("value") + View.substr(2, 5).size();
+    });
+    expectAllocs("UnixStyle::tokenize", 0, [&]() { Sink += tokenizeAll(Unix, UnixArgs); });
+    expectAllocs("WindowsStyle::tokenize", 0, [&]() { Sink += tokenizeAll(Windows, WindowsArgs); });
+    expectAllocs("OptionStyle::tokenize", 0, [&]() { Sink += tokenizeAll(Generic, GenericArgs); });
+
+    //* Registration
+    bool Outputs[8] = {};
+    const Flags ShortFlags = {"-a", "--alpha"};
+    const string LongHelp(64, 'h');
+
+    expectAllocs("BooleanArg with 2 short flags", 2, [&]() {
+        BooleanArg Arg(Outputs[0], {"-a", "--alpha"});
+    });
+    expectAllocs("IOptionalArgument::setFlags, 2 short flags", 2, [&]() {
+        BooleanArg Arg(Outputs[0], Flags());
+        Arg.setFlags(ShortFlags);
+    });
+    expectAllocs("IArgument::setHelp, short help", 0, [&]() {
+        BooleanArg Arg(Outputs[0], Flags());
+        Arg.setHelp("Short help");
+    });
+    expectAllocs("IArgument::setHelp, long help", 1, [&]() {
+        BooleanArg Arg(Outputs[0], Flags());
+        Arg.setHelp(LongHelp);
+    });
+
+    {
+        const size_t Count = 1000;
+        vector<string> Names;
+        Names.reserve(Count);
+        for (size_t i = 0; i < Count; ++i) Names.push_back("--opt" + to_string(i));
+
+        ArgumentParser Parser;
+        // Per argument: flags list node, shared copy, amortized growth of the parser containers
+        expectAllocs("ArgumentParser::addArgument x1000", Count * 3, [&]() {
+            for (size_t i = 0; i < Count; ++i) Parser.addArgument(BooleanArg(Outputs[1], {Names[i]}));
+        });
+    }
+
+    //* Lookups
+    FlagIndex Index;
+    Index.insert("--alpha", 0);
+    Index.insert("-a", 0);
+    expectAllocs("FlagIndex::find", 0, [&]() {
+        Sink += Index.find("--alpha") + Index.find("--missing");
+    });
+
+    //* Parsing
+    ArgumentParser Parser;
+    Parser.addArgument(BooleanArg(Outputs[2], {"-a", "--alpha"}));
+    Parser.addArgument(BooleanArg(Outputs[3], {"-b", "--beta"}, "", NARGS::ZERO_OR_ONE));
+    Parser.addArgument(BooleanArg(Outputs[4], {"-c", "--gamma"}, "", 1));
+
+    vector<const char *> Argv = {"alloc_test"};
+    for (size_t i = 0; i < 1000; ++i) {
+        Argv.push_back("-a");
+        Argv.push_back("--beta=yes");
+        Argv.push_back("-b");
+        Argv.push_back("off");
+        Argv.push_back("--gamma");
+        Argv.push_back("true");
+    }
+    const int Argc = static_cast<int>(Argv.size());
+
+    // Warm up: the first calls size the arena
+    Parser.parse(Argc, Argv.data());
+    Parser.parse(Argc, Argv.data());
+    expectAllocs("ArgumentParser::parse, steady state", 0, [&]() {
+        Parser.parse(Argc, Argv.data());
+    });
+
+    ParseResult Result;
+    expectAllocs("ArgumentParser::parse into new ParseResult", 8, [&]() {
+        Parser.parse(Argc, Argv.data(), Result);
+    });
+    Parser.parse(Argc, Argv.data(), Result);
+    expectAllocs("ArgumentParser::parse into ParseResult, steady state", 0, [&]() {
+        Parser.parse(Argc, Argv.data(), Result);
+    });
+
+    const char *Invalid[] = {"alloc_test", "-a", "--beta=yes", "--unknown"};
+    expectAllocs("ArgumentParser::tryParse, rejected command line", 0, [&]() {
+        Sink += static_cast<size_t>(Parser.tryParse(4, Invalid, Result).Code);
+    });
+
+    const char *Cluster[] = {"alloc_test", "-ac", "yes", "-abno"};
+    Parser.parse(4, Cluster, Result);
+    expectAllocs("ArgumentParser::parse, short option clusters", 0, [&]() {
+        Parser.parse(4, Cluster, Result);
+    });
+
+    Parser.setAbbreviationsEnabled();
+    const char *Abbreviated[] = {"alloc_test", "--alp", "--gam", "on", "--b"};
+    Parser.parse(5, Abbreviated, Result);
+    expectAllocs("ArgumentParser::parse, abbreviated options", 0, [&]() {
+        Parser.parse(5, Abbreviated, Result);
+    });
+
+    Parser.addArgument(BooleanArg(Outputs[5], {"--delta"}, "", NARGS::ZERO_OR_ONE)).setEnvVar("ALLOC_TEST_DELTA");
+    test_common::setEnv("ALLOC_TEST_DELTA", "yes");
+    const char *WithoutDelta[] = {"alloc_test", "-a"};
+    Parser.parse(2, WithoutDelta, Result);
+    expectAllocs("ArgumentParser::parse, environment variables", 0, [&]() {
+        Parser.parse(2, WithoutDelta, Result);
+    });
+
+    FILE *Config = fopen("alloc_test.ini", "w");
+    for (size_t i = 0; i < 1000; ++i) fputs("# options\nalpha\ngamma = on\n", Config);
+    fclose(Config);
+    Parser.setConfigFile("alloc_test.ini");
+    const char *WithBeta[] = {"alloc_test", "--beta"};
+    Parser.parse(2, WithBeta, Result);
+    expectAllocs("ArgumentParser::parse, config file", 0, [&]() {
+        Parser.parse(2, WithBeta, Result);
+    });
+    remove("alloc_test.ini");
+    Parser.setConfigFile("");
+
+    for (size_t i = 0; i < 100; ++i) {
+        Parser.addSubcommand("cmd" + to_string(i), [&Outputs](ArgumentParser &Command) {
+            Command.addArgument(BooleanArg(Outputs[6], {"-a", "--all"}));
+        });
+    }
+    const char *WithSubcommand[] = {"alloc_test", "-a", "cmd42", "--all"};
+    Parser.parse(4, WithSubcommand, Result);
+    expectAllocs("ArgumentParser::parse, subcommand", 0, [&]() {
+        Parser.parse(4, WithSubcommand, Result);
+    });
+
+    Parser.formatHelp(100);
+    expectAllocs("ArgumentParser::formatHelp, cached", 0, [&]() {
+        Sink += Parser.formatHelp(100).size();
+    });
+    Parser.formatHelp(0);
+    expectAllocs("ArgumentParser::formatHelp, cached narrowest width", 0, [&]() {
+        Sink += Parser.formatHelp(0).size() + Parser.formatHelp(HelpFormatter::MIN_WIDTH).size();
+    });
+
+    ArgumentParser Grouped;
+    Grouped.addArgument(BooleanArg(Outputs[7], {"--json"}));
+    Grouped.addArgument(BooleanArg(Outputs[7], {"--yaml"}));
+    Grouped.addArgument(BooleanArg(Outputs[7], {"--output"})).setRequired();
+    Grouped.addGroup(EXACTLY_ONE, {"--json", "--yaml"});
+    const char *Formats[] = {"alloc_test", "--output", "--yaml"};
+    const char *Conflicting[] = {"alloc_test", "--output", "--yaml", "--json"};
+    Grouped.parse(3, Formats, Result);
+    expectAllocs("ArgumentParser::tryParse, required and groups", 0, [&]() {
+        Sink += static_cast<size_t>(Grouped.tryParse(3, Formats, Result).Code);
+        Sink += static_cast<size_t>(Grouped.tryParse(4, Conflicting, Result).Code);
+    });
+
+    ArgumentParser Ruled;
+    Ruled.addArgument(BooleanArg(Outputs[7], {"--tls"})).addRequires("--cert");
+    Ruled.addArgument(BooleanArg(Outputs[7], {"--cert"}));
+    Ruled.addArgument(BooleanArg(Outputs[7], {"--verbose"})).addImplies("--debug");
+    Ruled.addArgument(BooleanArg(Outputs[7], {"--debug"})).addImplies("--log");
+    Ruled.addArgument(BooleanArg(Outputs[7], {"--log"}));
+    const char *Secure[] = {"alloc_test", "--tls", "--cert", "--verbose"};
+    const char *Insecure[] = {"alloc_test", "--tls", "--verbose"};
+    Ruled.parse(4, Secure, Result);
+    expectAllocs("ArgumentParser::tryParse, requires and implies", 0, [&]() {
+        Sink += static_cast<size_t>(Ruled.tryParse(4, Secure, Result).Code);
+        Sink += static_cast<size_t>(Ruled.tryParse(3, Insecure, Result).Code);
+    });
+
+    vector<string> Sources, Destination;
+    ArgumentParser Copying;
+    Copying.addArgument(ListArg(Sources, {"sources"}, "", NARGS::ONE_AND_MORE));
+    Copying.addArgument(ListArg(Destination, {"destination"}));
+    Copying.addArgument(BooleanArg(Outputs[7], {"-v"}));
+    const char *Files[] = {"alloc_test", "a", "-v", "b", "c", "dir"};
+    Copying.parse(6, Files, Result);
+    expectAllocs("ArgumentParser::tryParse, positional arguments", 0, [&]() {
+        Sink += static_cast<size_t>(Copying.tryParse(6, Files, Result).Code);
+    });
+
+    const CompiledParser Compiled = Parser.compile();
+    Compiled.parse(Argc, Argv.data(), Result);
+    expectAllocs("CompiledParser::parse, steady state", 0, [&]() {
+        Compiled.parse(Argc, Argv.data(), Result);
+    });
+
+    //* Values
+    int Integer = 0;
+    double Double = 0;
+    IntegerArg IntegerOpt(Integer, {"-n"});
+    DoubleArg DoubleOpt(Double, {"-d"});
+    expectAllocs("NumericArg::applyValue", 0, [&]() {
+        IntegerOpt.applyValue("-0x7fff");
+        DoubleOpt.applyValue("1.5e-3");
+        DoubleOpt.applyValue("2.2250738585072011e-308");
+    });
+    expectAllocs("NumericArg::validateValue, rejected values", 0, [&]() {
+        Sink += static_cast<size_t>(IntegerOpt.validateValue("2147483648")) + static_cast<size_t>(DoubleOpt.validateValue("1e400"));
+    });
+
+    uint64_t Size = 0, Duration = 0;
+    SizeArg SizeOpt(Size, {"-s"});
+    DurationArg DurationOpt(Duration, {"-t"});
+    expectAllocs("SizeArg and DurationArg::applyValue", 0, [&]() {
+        SizeOpt.applyValue("1.5GiB");
+        DurationOpt.applyValue("2h30m15.5s");
+    });
+
+    int Codec = 0;
+    ChoiceArg CodecOpt(Codec, {"--compression"}, {{"none", 0}, {"lz4", 1}, {"zstd", 2}});
+    expectAllocs("ChoiceArg::applyValue", 0, [&]() {
+        CodecOpt.applyValue("zstd");
+    });
+
+    const size_t HostsCount = 1000;
+    string Hosts;
+    for (size_t i = 0; i < HostsCount; ++i) {
+        if (i) Hosts += ',';
+        Hosts += "h" + to_string(i);
+    }
+    vector<string> HostsList;
+    ListArg HostsOpt(HostsList, {"--hosts"}, "", 1, false, false, ',');
+    expectAllocs("ListArg::applyValue, 1000 short items", 1, [&]() {
+        HostsOpt.applyDefault();
+        HostsOpt.applyValue(Hosts);
+    });
+    expectAllocs("ListArg::applyValue, steady state", 0, [&]() {
+        HostsOpt.applyDefault();
+        HostsOpt.applyValue(Hosts);
+    });
+
+    bool IsStaticParsed = checkStaticParser();
+    expectAllocs("StaticParser::parse", 0, [&]() {
+        IsStaticParsed = IsStaticParsed && checkStaticParser();
+    });
+    expectTrue("StaticParser parses with constexpr schema", IsStaticParsed);
+
+    expectTrue("keep results alive", Sink != 0);
+
+    return test_common::finish();
+}
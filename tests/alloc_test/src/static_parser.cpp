@@ -0,0 +1,45 @@
+/**
+ * @file static_parser.cpp
+ * @brief Checks of compile-time parser schemas
+ * @details Compiled as C++14, which argparse/StaticParser.hpp requires.
+ * Schemas which must not compile are checked by tests/alloc_test/compile_fail
+ *
+ * @version 1.0.0
+ * @authors Eugene Azimut
+ * @copyright Copyright (c) Eugene Azimut, 2026
+ */
+#include <argparse/StaticParser.hpp>
+
+using namespace argparse;
+using namespace argparse::args;
+
+
+
+namespace {
+    constexpr StaticOption Options[] = {
+        StaticOption("-v", "--verbose"),
+        StaticOption("-o", "--output", 1, "a.out"),
+        StaticOption(nullptr, "--color", NARGS::ZERO_OR_ONE, "auto")
+    };
+
+    constexpr auto Parser = makeStaticParser(Options);
+
+    // The flag table is built during compilation
+    static_assert(Parser.indexOf("--verbose") == 0 && Parser.indexOf("-v") == 0, "StaticParser indexes flags");
+    static_assert(Parser.indexOf("-o") == 1 && Parser.indexOf("--color") == 2, "StaticParser indexes flags");
+    static_assert(Parser.indexOf("--missing") == decltype(Parser)::NOT_FOUND, "StaticParser rejects unknown flags");
+}
+
+
+
+bool checkStaticParser() {
+    const char *Argv[] = {"alloc_test", "-v", "--output", "out.bin", "--verbose", "--color=never", "file", "-v"};
+    StaticResult<3> Result;
+    Parser.parse(8, Argv, Result);
+
+    return
+        Parser.count(Result, "--verbose") == 2 &&
+        Parser.value(Result, "-o") == "out.bin" &&
+        Parser.value(Result, "--color") == "never" &&
+        Result.Positional == 6;
+}
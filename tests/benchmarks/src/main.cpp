@@ -0,0 +1,288 @@
+/**
+ * @file main.cpp
+ * @brief Microbenchmarks of libargparse hot paths
+ * @details Every case runs on synthetic command lines of 10 to 1M tokens and reports:
+ *   * ns/token     - best of several runs;
+ *   * allocs/token - global operator new calls of the best run;
+ *   * peak RSS     - peak resident set size of the process so far
+ *
+ * Inputs are generated deterministically, so numbers are comparable between builds.
+ * Cases can be selected with --split, --register and --parse (all by default).
+ * Build in Release configuration to get meaningful numbers
+ *
+ * @version 1.0.0
+ * @authors Eugene Azimut
+ * @copyright Copyright (c) Eugene Azimut, 2026
+ */
+#include <argparse/argparse.hpp>
+#include <argparse/OptionStyles/WindowsStyle.hpp>
+
+#include <test_common/alloc_counter.hpp>
+
+#include <chrono>
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+#include <functional>
+#include <string>
+#include <vector>
+
+#if defined(_WIN32)
+    #include <windows.h>
+    #include <psapi.h>
+#else
+    #include <sys/resource.h>
+#endif
+
+using namespace std;
+using namespace argparse;
+using namespace argparse::args;
+using namespace argparse::OptStyles;
+
+
+
+namespace {
+    constexpr size_t OPTIONS_COUNT = 64;    ///< Number of registered options in parse benchmarks
+
+    /**
+     * @brief Returns peak resident set size of the process in KiB
+     */
+    size_t getPeakMemory() {
+    #if defined(_WIN32)
+        PROCESS_MEMORY_COUNTERS Counters;
+        if (!GetProcessMemoryInfo(GetCurrentProcess(), &Counters, sizeof(Counters))) return 0;
+        return Counters.PeakWorkingSetSize / 1024;
+    #else
+        rusage Usage;
+        if (getrusage(RUSAGE_SELF, &Usage) != 0) return 0;
+        return static_cast<size_t>(Usage.ru_maxrss);
+    #endif
+    }
+
+    /**
+     * @struct Command
+     * @brief Synthetic command line: owning storage and argv view of it
+     */
+    struct Command {
+        vector<string>       Storage;   ///< Tokens
+        vector<const char *> Argv;      ///< argv[0] is the program name
+
+        void finish() {
+            Argv.clear();
+            Argv.reserve(Storage.size() + 1);
+            Argv.push_back("benchmarks");
+            for (const string &Token: Storage) Argv.push_back(Token.c_str());
+        }
+
+        int argc() const {
+            return static_cast<int>(Argv.size());
+        }
+    };
+
+    /**
+     * @brief Generates Count options of the given style in a deterministic mix of shapes
+     * @details Shapes: short flag, short flag with value, long flag, long flag with value
+     */
+    Command makeOptions(size_t Count, const char *Short, const char *Long, const char *Delim) {
+        Command Cmd;
+        Cmd.Storage.reserve(Count);
+        for (size_t i = 0; i < Count; ++i) {
+            const string Name = "opt" + to_string(i % OPTIONS_COUNT);
+            switch (i % 4) {
+                case 0: Cmd.Storage.push_back(string(Short) + "a"); break;
+                case 1: Cmd.Storage.push_back(string(Short) + "bvalue"); break;
+                case 2: Cmd.Storage.push_back(Long + Name); break;
+                default: Cmd.Storage.push_back(Long + Name + Delim + "value"); break;
+            }
+        }
+        Cmd.finish();
+        return Cmd;
+    }
+
+    /**
+     * @brief Generates Count tokens accepted by parser filled by fillParser(ArgumentParser &, bool *)
+     */
+    Command makeParseInput(size_t Count) {
+        Command Cmd;
+        Cmd.Storage.reserve(Count);
+        for (size_t i = 0; i < Count; ++i) {
+            const string Flag = "--opt" + to_string(i % OPTIONS_COUNT);
+            switch (i % 3) {
+                case 0: Cmd.Storage.push_back(Flag); break;
+                case 1: Cmd.Storage.push_back(Flag + "=yes"); break;
+                default: Cmd.Storage.push_back("-o"); break;
+            }
+        }
+        Cmd.finish();
+        return Cmd;
+    }
+
+    /**
+     * @brief Registers OPTIONS_COUNT boolean options
+     */
+    void fillParser(ArgumentParser &Parser, bool *Outputs) {
+        for (size_t i = 0; i < OPTIONS_COUNT; ++i) {
+            Flags OptFlags = {"--opt" + to_string(i)};
+            if (i == 0) OptFlags.push_back("-o");
+            Parser.addArgument(BooleanArg(Outputs[i], move(OptFlags), "", NARGS::ZERO_OR_ONE));
+        }
+    }
+
+    /**
+     * @brief Runs Body Repeat times and prints the best run
+     * @param[in] Name Case name
+     * @param[in] Tokens Number of tokens processed by one run
+     * @param[in] Repeat Number of runs
+     * @param[in] Body Benchmarked code
+     */
+    void measure(const char *Name, size_t Tokens, size_t Repeat, const function<void()> &Body) {
+        double BestNs = 0;
+        size_t BestAllocs = 0;
+
+        for (size_t Run = 0; Run < Repeat; ++Run) {
+            const size_t AllocsBefore = AllocationsCount;
+            const chrono::steady_clock::time_point Start = chrono::steady_clock::now();
+            Body();
+            const chrono::steady_clock::time_point Stop = chrono::steady_clock::now();
+            const size_t Allocs = AllocationsCount - AllocsBefore;
+
+            const double Ns = static_cast<double>(
+                chrono::duration_cast<chrono::nanoseconds>(Stop - Start).count()
+            );
+            if (Run == 0 || Ns < BestNs) {
+                BestNs     = Ns;
+                BestAllocs = Allocs;
+            }
+        }
+
+        printf(
+            "%-28s %9zu %12.2f %14.3f %12zu\n",
+            Name, Tokens,
+            BestNs / static_cast<double>(Tokens),
+            static_cast<double>(BestAllocs) / static_cast<double>(Tokens),
+            getPeakMemory()
+        );
+    }
+
+    /**
+     * @brief Benchmarks splitting of every token of Cmd with Style
+     */
+    void benchSplit(const char *Name, const OptionStyle &Style, const Command &Cmd, size_t Repeat) {
+        measure(Name, Cmd.Storage.size(), Repeat, [&]() {
+            string Option, Value;
+            for (const string &Token: Cmd.Storage) Style.splitArg(Token, Option, Value);
+        });
+    }
+
+    /**
+     * @brief Benchmarks tokenizing of every token of Cmd with Style
+     */
+    void benchTokenize(const char *Name, const OptionStyle &Style, const Command &Cmd, size_t Repeat) {
+        measure(Name, Cmd.Storage.size(), Repeat, [&]() {
+            size_t Sink = 0;
+            for (size_t i = 1; i < Cmd.Argv.size(); ++i) Sink += Style.tokenize(Cmd.Argv[i]).Option.size();
+            if (Sink == 0) abort();
+        });
+    }
+
+    /**
+     * @brief Benchmarks classification pass over every token of Cmd with Style
+     */
+    void benchClassify(const char *Name, const OptionStyle &Style, const Command &Cmd, size_t Repeat) {
+        vector<TokenClass> Classes(Cmd.Storage.size());
+        measure(Name, Cmd.Storage.size(), Repeat, [&]() {
+            Style.classify(Cmd.Argv.data() + 1, Cmd.Storage.size(), Classes.data());
+            if (Classes.back().Length == 0) abort();
+        });
+    }
+}
+
+
+
+int main(int argc, const char *argv[]) {
+    bool RunSplit = false, RunRegister = false, RunParse = false;
+    ArgumentParser Cli;
+    Cli.addArgument(BooleanArg(RunSplit, {"--split"}, "Run splitting cases only"));
+    Cli.addArgument(BooleanArg(RunRegister, {"--register"}, "Run registration cases only"));
+    Cli.addArgument(BooleanArg(RunParse, {"--parse"}, "Run parsing cases only"));
+    Cli.parse(argc, argv);
+
+    if (!RunSplit && !RunRegister && !RunParse) {
+        RunSplit = RunRegister = RunParse = true;
+    }
+
+    const size_t MaxTokens = 1000000;
+    const size_t Repeat    = 5;
+
+    printf("%-28s %9s %12s %14s %12s\n", "case", "tokens", "ns/token", "allocs/token", "peak KiB");
+
+    for (size_t Tokens = 10; Tokens <= MaxTokens; Tokens *= 10) {
+        const size_t Runs = Tokens >= 100000 ? 2 : Repeat;
+
+        if (RunSplit) {
+            const OptionStyle  Generic("--", "=");
+            const UnixStyle    Unix;
+            const WindowsStyle Windows;
+
+            const Command GenericCmd = makeOptions(Tokens, "--", "--", "=");
+            const Command UnixCmd    = makeOptions(Tokens, "-", "--", "=");
+            const Command WindowsCmd = makeOptions(Tokens, "/", "/", ":");
+
+            benchSplit("OptionStyle::splitArg", Generic, GenericCmd, Runs);
+            benchSplit("UnixStyle::splitArg", Unix, UnixCmd, Runs);
+            benchSplit("WindowsStyle::splitArg", Windows, WindowsCmd, Runs);
+            benchTokenize("OptionStyle::tokenize", Generic, GenericCmd, Runs);
+            benchTokenize("UnixStyle::tokenize", Unix, UnixCmd, Runs);
+            benchTokenize("WindowsStyle::tokenize", Windows, WindowsCmd, Runs);
+            benchClassify("OptionStyle::classify", Generic, GenericCmd, Runs);
+            benchClassify("UnixStyle::classify", Unix, UnixCmd, Runs);
+        }
+
+        if (RunRegister && Tokens <= 100000) {
+            // Here "tokens" are registered arguments
+            bool Output = false;
+            measure("ArgumentParser::addArgument", Tokens, Runs, [&]() {
+                ArgumentParser Parser;
+                for (size_t i = 0; i < Tokens; ++i) {
+                    Parser.addArgument(BooleanArg(Output, {"-" + to_string(i), "--option-" + to_string(i)}));
+                }
+            });
+        }
+
+        if (RunParse) {
+            bool Outputs[OPTIONS_COUNT];
+            ArgumentParser Parser;
+            fillParser(Parser, Outputs);
+            Parser.parse(1, argv);  // Warm up
+
+            const Command Cmd = makeParseInput(Tokens);
+            ParseResult Result;
+            Parser.parse(Cmd.argc(), const_cast<const char **>(Cmd.Argv.data()), Result);    // Warm up
+
+            measure("ArgumentParser::parse", Tokens, Runs, [&]() {
+                Parser.parse(Cmd.argc(), const_cast<const char **>(Cmd.Argv.data()));
+            });
+            measure("ArgumentParser::parse(Res)", Tokens, Runs, [&]() {
+                Parser.parse(Cmd.argc(), const_cast<const char **>(Cmd.Argv.data()), Result);
+            });
+
+            // Variadic positional followed by a fixed one: "file0 file1 ... dir"
+            vector<string> Files, Destination;
+            ArgumentParser Copying;
+            Copying.addArgument(ListArg(Files, {"files"}, "", NARGS::ONE_AND_MORE));
+            Copying.addArgument(ListArg(Destination, {"destination"}));
+
+            Command Paths;
+            Paths.Storage.reserve(Tokens);
+            for (size_t i = 0; i < Tokens; ++i) Paths.Storage.push_back("dir/file" + to_string(i));
+            Paths.finish();
+            Copying.parse(Paths.argc(), const_cast<const char **>(Paths.Argv.data()), Result);  // Warm up
+
+            measure("ArgumentParser::parse(pos)", Tokens, Runs, [&]() {
+                Copying.parse(Paths.argc(), const_cast<const char **>(Paths.Argv.data()), Result);
+            });
+        }
+    }
+
+    return 0x00;
+}
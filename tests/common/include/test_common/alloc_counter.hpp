@@ -0,0 +1,64 @@
+/**
+ * @file alloc_counter.hpp
+ * @brief Global operator new replaced to count allocations
+ * @details Replacement allocation functions can't be inline,
+ * so exactly one translation unit of an executable must include the header
+ *
+ * @version 1.0.0
+ * @authors Eugene Azimut
+ * @copyright Copyright (c) Eugene Azimut, 2026
+ */
+#pragma once
+
+#include <cstddef>
+#include <cstdlib>
+#include <new>
+
+
+
+static size_t AllocationsCount = 0;     ///< Number of global operator new calls
+
+void *operator new(size_t Size) {
+    ++AllocationsCount;
+    void *Ptr = malloc(Size ? Size : 1);
+    if (!Ptr) throw std::bad_alloc();
+    return Ptr;
+}
+
+void *operator new[](size_t Size) {
+    return operator new(Size);
+}
+
+// Non-throwing forms are used by std::stable_sort and std::get_temporary_buffer
+void *operator new(size_t Size, const std::nothrow_t &) noexcept {
+    ++AllocationsCount;
+    return malloc(Size ? Size : 1);
+}
+
+void *operator new[](size_t Size, const std::nothrow_t &Tag) noexcept {
+    return operator new(Size, Tag);
+}
+
+void operator delete(void *Ptr) noexcept {
+    free(Ptr);
+}
+
+void operator delete[](void *Ptr) noexcept {
+    free(Ptr);
+}
+
+void operator delete(void *Ptr, size_t) noexcept {
+    free(Ptr);
+}
+
+void operator delete[](void *Ptr, size_t) noexcept {
+    free(Ptr);
+}
+
+void operator delete(void *Ptr, const std::nothrow_t &) noexcept {
+    free(Ptr);
+}
+
+void operator delete[](void *Ptr, const std::nothrow_t &) noexcept {
+    free(Ptr);
+}
@@ -0,0 +1,56 @@
+/**
+ * @file checks.hpp
+ * @brief Checks shared by test executables
+ * @details Every check prints one line. Exit code of a test is the number of failed checks,
+ * see test_common::finish()
+ *
+ * @version 1.0.0
+ * @authors Eugene Azimut
+ * @copyright Copyright (c) Eugene Azimut, 2026
+ */
+#pragma once
+
+#include <cstdio>
+#include <cstdlib>
+
+
+
+namespace test_common {
+    /**
+     * @brief Returns number of failed checks
+     */
+    inline int &failures() {
+        static int Count = 0;
+        return Count;
+    }
+
+    /**
+     * @brief Checks a condition
+     * @param[in] Name Check name
+     * @param[in] Condition Checked condition
+     */
+    inline void expectTrue(const char *Name, bool Condition) {
+        if (!Condition) ++failures();
+        printf("[%s] %s\n", Condition ? " OK " : "FAIL", Name);
+    }
+
+    /**
+     * @brief Prints the summary
+     * @return Number of failed checks, used as exit code
+     */
+    inline int finish() {
+        printf("%d check(s) failed\n", failures());
+        return failures();
+    }
+
+    /**
+     * @brief Sets environment variable Name to Value
+     */
+    inline void setEnv(const char *Name, const char *Value) {
+    #if defined(_WIN32)
+        _putenv_s(Name, Value);
+    #else
+        setenv(Name, Value, 1);
+    #endif
+    }
+}
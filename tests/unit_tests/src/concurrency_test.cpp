@@ -0,0 +1,99 @@
+/**
+ * @file concurrency_test.cpp
+ * @brief Behavior of CompiledParser shared between threads
+ *
+ * @version 1.0.0
+ * @authors Eugene Azimut
+ * @copyright Copyright (c) Eugene Azimut, 2026
+ */
+#include <argparse/argparse.hpp>
+
+#include <test_common/checks.hpp>
+
+#include <string>
+#include <thread>
+#include <vector>
+
+using namespace std;
+using namespace argparse;
+using namespace argparse::args;
+using test_common::expectTrue;
+
+
+
+namespace {
+    constexpr size_t THREADS_COUNT = 8;
+    constexpr size_t ITERATIONS    = 2000;
+
+    int Jobs = 0;   ///< Output of the subcommand argument, never written by CompiledParser
+
+    /**
+     * @brief Parses command lines unique to Thread and counts wrong results
+     */
+    size_t parseInThread(const CompiledParser &Parser, size_t Thread) {
+        static const char *const Modes[] = {"fast", "safe", "slow"};
+        const uint32_t Number = Parser.indexOf("-n");
+        const uint32_t Mode   = Parser.indexOf("--mode");
+
+        size_t Failures = 0;
+        ParseResult Result;
+        for (size_t i = 0; i < ITERATIONS; ++i) {
+            const string Value = to_string(Thread * ITERATIONS + i);
+            const string Invalid = Value + "x";
+            const char *Expected = Modes[(Thread + i) % 3];
+            const bool IsInvalid = i % 4 == 3;
+            const bool IsNested  = i % 2 == 1;
+            const char *Args[] = {
+                "concurrency_test", "-n", IsInvalid ? Invalid.c_str() : Value.c_str(), "--mode", Expected,
+                "run", "--jobs", Value.c_str()
+            };
+
+            const ArgparseError Error = Parser.tryParse(IsNested ? 8 : 5, Args, Result);
+            if (IsInvalid) {
+                if (Error.Code != INVALID_VALUE || Error.Position != 2 || Error.Arg != Invalid) ++Failures;
+                continue;
+            }
+
+            const bool IsParsed =
+                !Error && *Result.getValues(Number).begin() == Value && *Result.getValues(Mode).begin() == Expected &&
+                (
+                    IsNested ?
+                    Result.getSubcommand() == "run" && *Result.getSubcommandResult().getValues(0).begin() == Value :
+                    Result.getSubcommand().empty()
+                );
+            if (!IsParsed) ++Failures;
+        }
+        return Failures;
+    }
+}
+
+
+
+int main() {
+    int Number = 0;
+    int Mode = -1;
+    ArgumentParser Parser;
+    Parser.addArgument(IntegerArg(Number, {"-n"})).setRange(0, static_cast<int>(THREADS_COUNT * ITERATIONS));
+    Parser.addArgument(ChoiceArg(Mode, {"--mode"}, {{"fast", 0}, {"safe", 1}, {"slow", 2}})).setRequired();
+    Parser.addSubcommand("run", [](ArgumentParser &Command) {
+        Command.addArgument(IntegerArg(Jobs, {"--jobs"}));
+    });
+    const CompiledParser Compiled = Parser.compile();
+
+    //* Every thread parses its own command lines into its own result
+    vector<size_t> Failures(THREADS_COUNT, 0);
+    vector<thread> Threads;
+    for (size_t t = 0; t < THREADS_COUNT; ++t) {
+        Threads.emplace_back([&Compiled, &Failures, t]() {
+            Failures[t] = parseInThread(Compiled, t);
+        });
+    }
+    for (thread &Worker: Threads) Worker.join();
+
+    size_t Total = 0;
+    for (size_t Count: Failures) Total += Count;
+    expectTrue("CompiledParser::tryParse parses concurrently into separate results", Total == 0);
+    expectTrue("CompiledParser::tryParse leaves output variables untouched", Number == 0 && Mode == -1 && Jobs == 0);
+
+    return test_common::finish();
+}
@@ -0,0 +1,78 @@
+/**
+ * @file constraints_test.cpp
+ * @brief Behavior of required arguments, groups and requires/implies rules
+ *
+ * @version 1.0.0
+ * @authors Eugene Azimut
+ * @copyright Copyright (c) Eugene Azimut, 2026
+ */
+#include <argparse/argparse.hpp>
+
+#include <test_common/checks.hpp>
+
+#include <string>
+#include <vector>
+
+using namespace std;
+using namespace argparse;
+using namespace argparse::args;
+using test_common::expectTrue;
+
+
+
+int main() {
+    bool Output = false;
+    ParseResult Result;
+
+    //* Required arguments and groups
+    ArgumentParser Grouped;
+    Grouped.addArgument(BooleanArg(Output, {"--json"}));
+    Grouped.addArgument(BooleanArg(Output, {"--yaml"}));
+    BooleanArg &Required = Grouped.addArgument(BooleanArg(Output, {"--output"}));
+    Required.setRequired();
+    Grouped.addGroup(EXACTLY_ONE, {"--json", "--yaml"});
+    const char *Formats[] = {"constraints_test", "--output", "--yaml"};
+    const char *Conflicting[] = {"constraints_test", "--output", "--yaml", "--json"};
+    expectTrue("ArgumentParser::tryParse accepts valid groups", !Grouped.tryParse(3, Formats, Result));
+    expectTrue("ArgumentParser::tryParse checks groups", Grouped.tryParse(4, Conflicting, Result).Code == EXCLUSIVE_OPTIONS);
+
+    const char *JsonOnly[] = {"constraints_test", "--json"};
+    Required.setRequired(false);
+    const bool IsOptional = !Grouped.tryParse(2, JsonOnly, Result);
+    Required.setRequired();
+    expectTrue(
+        "ArgumentParser::tryParse sees setRequired between parses",
+        IsOptional && Grouped.tryParse(2, JsonOnly, Result).Code == MISSING_REQUIRED_OPTION
+    );
+
+    //* Rules
+    ArgumentParser Ruled;
+    Ruled.addArgument(BooleanArg(Output, {"--tls"})).addRequires("--cert");
+    Ruled.addArgument(BooleanArg(Output, {"--cert"}));
+    Ruled.addArgument(BooleanArg(Output, {"--verbose"})).addImplies("--debug");
+    Ruled.addArgument(BooleanArg(Output, {"--debug"})).addImplies("--log");
+    BooleanArg &Log = Ruled.addArgument(BooleanArg(Output, {"--log"}));
+    const char *Insecure[] = {"constraints_test", "--tls", "--verbose"};
+    expectTrue("ArgumentParser::tryParse checks rules", Ruled.tryParse(3, Insecure, Result).Code == MISSING_DEPENDENCY);
+    expectTrue("ArgumentParser::tryParse adds implied arguments", Result.getCount(Ruled.indexOf("--log")) == 1);
+
+    Log.addRequires("--cert");
+    const char *Logging[] = {"constraints_test", "--log"};
+    expectTrue("ArgumentParser::tryParse sees rules added after parsing", Ruled.tryParse(2, Logging, Result).Code == MISSING_DEPENDENCY);
+
+    vector<string> WideFlags;
+    for (size_t i = 0; i < 130; ++i) WideFlags.push_back("--w" + to_string(i));
+    ArgumentParser Wide;
+    for (const string &Flag: WideFlags) Wide.addArgument(BooleanArg(Output, {Flag}));
+    BooleanArg &WideArg = Wide.addArgument(BooleanArg(Output, {"--wide"}));
+    WideArg.addRequires("--w70");
+    WideArg.addRequires("--w129");
+    const char *Partial[] = {"constraints_test", "--wide", "--w70"};
+    const ArgparseError Violation = Wide.tryParse(3, Partial, Result);
+    expectTrue(
+        "ArgumentParser::tryParse checks rules across words",
+        Violation.Code == MISSING_DEPENDENCY && Violation.Position == 129 && Violation.Arg == "--wide"
+    );
+
+    return test_common::finish();
+}
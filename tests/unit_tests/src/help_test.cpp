@@ -0,0 +1,63 @@
+/**
+ * @file help_test.cpp
+ * @brief Behavior of help rendering and suggestions of unrecognized options
+ *
+ * @version 1.0.0
+ * @authors Eugene Azimut
+ * @copyright Copyright (c) Eugene Azimut, 2026
+ */
+#include <argparse/argparse.hpp>
+
+#include <test_common/checks.hpp>
+
+#include <string>
+#include <vector>
+
+using namespace std;
+using namespace argparse;
+using namespace argparse::args;
+using test_common::expectTrue;
+
+
+
+int main() {
+    bool Outputs[8] = {};
+
+    //* Help
+    ArgumentParser Parser;
+    Parser.addArgument(BooleanArg(Outputs[0], {"-a", "--alpha"}));
+    Parser.addArgument(BooleanArg(Outputs[1], {"-c", "--gamma"}, "", 1));
+    BooleanArg &Delta = Parser.addArgument(BooleanArg(Outputs[2], {"--delta"}));
+
+    const size_t HelpSize = Parser.formatHelp(100).size();
+    expectTrue("ArgumentParser::formatHelp lists options", HelpSize != 0 && Parser.formatHelp(100).find("--gamma") != string::npos);
+    Delta.setHelp("Turns delta on");
+    expectTrue("ArgumentParser::formatHelp sees changes of arguments", Parser.formatHelp(100).find("Turns delta on") != string::npos);
+    expectTrue(
+        "ArgumentParser::formatHelp clamps width to HelpFormatter::MIN_WIDTH",
+        Parser.formatHelp(0) == Parser.formatHelp(HelpFormatter::MIN_WIDTH)
+    );
+
+    //* Suggestions
+    const string LongFlag = "--" + string(70, 'l');
+    string LongTypo = LongFlag;
+    LongTypo[40] = 'x';
+    ArgumentParser Suggesting;
+    Suggesting.addArgument(BooleanArg(Outputs[3], {"--verbose"}));
+    Suggesting.addArgument(BooleanArg(Outputs[3], {"--version"}));
+    Suggesting.addArgument(BooleanArg(Outputs[3], {"--car"}));
+    Suggesting.addArgument(BooleanArg(Outputs[3], {"--cat"}));
+    Suggesting.addArgument(BooleanArg(Outputs[3], {LongFlag}));
+    expectTrue("ArgumentParser::getSuggestions counts transpositions", Suggesting.getSuggestions("--verobse") == vector<string>{"--verbose"});
+    expectTrue(
+        "ArgumentParser::getSuggestions cuts off far flags",
+        Suggesting.getSuggestions("--verbxxx").empty() && Suggesting.getSuggestions("--verbxxx", 3) == vector<string>{"--verbose"}
+    );
+    expectTrue("ArgumentParser::getSuggestions keeps ties in order of registration", Suggesting.getSuggestions("--cab") == (vector<string>{"--car", "--cat"}));
+    expectTrue(
+        "ArgumentParser::getSuggestions compares flags longer than 64 characters",
+        Suggesting.getSuggestions(LongTypo) == vector<string>{LongFlag} && Suggesting.getSuggestions(LongTypo + "xyz").empty()
+    );
+
+    return test_common::finish();
+}
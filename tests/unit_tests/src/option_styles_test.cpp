@@ -0,0 +1,83 @@
+/**
+ * @file option_styles_test.cpp
+ * @brief Behavior of option styles
+ *
+ * @version 1.0.0
+ * @authors Eugene Azimut
+ * @copyright Copyright (c) Eugene Azimut, 2026
+ */
+#include <argparse/argparse.hpp>
+
+#include <test_common/checks.hpp>
+
+#include <cstring>
+#include <stdexcept>
+#include <string>
+
+using namespace std;
+using namespace argparse;
+using namespace argparse::OptStyles;
+using test_common::expectTrue;
+
+
+
+namespace {
+    /**
+     * @brief Returns message of exception thrown by OptionStyle::splitArg, empty if nothing is thrown
+     */
+    string splitError(const OptionStyle &Style, const string &Arg) {
+        string Option, Value;
+        try {
+            Style.splitArg(Arg, Option, Value);
+        } catch (const runtime_error &Error) {
+            return Error.what();
+        }
+        return string();
+    }
+}
+
+
+
+int main() {
+    const UnixStyle Unix;
+
+    // Vector scan of classify must agree with strlen for every alignment across 16- and 32-byte chunks
+    bool IsClassified = true;
+    alignas(64) char Chunks[192];
+    for (size_t Offset = 0; Offset < 64; ++Offset) {
+        for (size_t Length = 0; Length <= 70; ++Length) {
+            memset(Chunks, 0, Offset);                                  // Terminators before the argument are ignored
+            memset(Chunks + Offset, 'x', Length);
+            Chunks[Offset + Length] = '\0';
+            memset(Chunks + Offset + Length + 1, 'y', sizeof(Chunks) - Offset - Length - 1);
+            if (Length) Chunks[Offset] = Length % 2 ? '-' : 'f';
+
+            const char *Args[] = {Chunks + Offset};
+            TokenClass Class;
+            Unix.classify(Args, 1, &Class);
+            const TokenKind Kind = Length % 2 ? OPTION : POSITIONAL;
+            IsClassified = IsClassified && Class.Length == strlen(Args[0]) && Class.Kind == Kind;
+        }
+    }
+    expectTrue("OptionStyle::classify measures arguments at every alignment", IsClassified);
+
+    // Messages of the throwing wrapper are the ones of the tokenizer before ArgparseError
+    const string NotProvided = "Invalid option (option not provided)";
+    expectTrue(
+        "UnixStyle::splitArg reports missing option",
+        splitError(Unix, "-") == NotProvided && splitError(Unix, "--") == NotProvided && splitError(Unix, "--=a") == NotProvided
+    );
+    expectTrue("UnixStyle::splitArg reports non-options", splitError(Unix, "file") == "Not an optional");
+    expectTrue(
+        "UnixStyle::splitArg reports delimiter as option",
+        splitError(Unix, "--=") == "Value delimiter (\"=\") cannot be an option" &&
+        splitError(Unix, "-=a") == "Value delimiter (\"=\") cannot be an option"
+    );
+    expectTrue(
+        "UnixStyle::splitArg reports delimiter in short option",
+        splitError(Unix, "-f=a") == "UnixStyle doesn't support value delimiters in short options"
+    );
+    expectTrue("OptionStyle::splitArg reports missing option", splitError(OptionStyle("/", ":"), "/:a") == "Option wasn't provided");
+
+    return test_common::finish();
+}
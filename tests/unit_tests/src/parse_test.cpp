@@ -0,0 +1,134 @@
+/**
+ * @file parse_test.cpp
+ * @brief Behavior of the command line parsing engine
+ *
+ * @version 1.0.0
+ * @authors Eugene Azimut
+ * @copyright Copyright (c) Eugene Azimut, 2026
+ */
+#include <argparse/argparse.hpp>
+
+#include <test_common/checks.hpp>
+
+#include <cstdio>
+#include <string>
+#include <vector>
+
+using namespace std;
+using namespace argparse;
+using namespace argparse::args;
+using test_common::expectTrue;
+
+
+
+int main() {
+    bool Outputs[8] = {};
+    ParseResult Result;
+
+    //* Options and values
+    ArgumentParser Parser;
+    Parser.addArgument(BooleanArg(Outputs[0], {"-a", "--alpha"}));
+    Parser.addArgument(BooleanArg(Outputs[1], {"-b", "--beta"}, "", NARGS::ZERO_OR_ONE));
+    Parser.addArgument(BooleanArg(Outputs[2], {"-c", "--gamma"}, "", 1));
+
+    vector<const char *> Argv = {"parse_test"};
+    for (size_t i = 0; i < 1000; ++i) {
+        Argv.push_back("-a");
+        Argv.push_back("--beta=yes");
+        Argv.push_back("-b");
+        Argv.push_back("off");
+        Argv.push_back("--gamma");
+        Argv.push_back("true");
+    }
+    const int Argc = static_cast<int>(Argv.size());
+
+    Parser.parse(Argc, Argv.data());
+    expectTrue("ArgumentParser::parse applies values", Outputs[0] && !Outputs[1] && Outputs[2]);
+    Parser.parse(Argc, Argv.data(), Result);
+    expectTrue("ParseResult counts occurrences", Result.getCount(1) == 2000 && Result.getValuesCount(1) == 2000);
+
+    const char *Invalid[] = {"parse_test", "-a", "--beta=yes", "--unknown"};
+    const ArgparseError Unknown = Parser.tryParse(4, Invalid, Result);
+    expectTrue("ArgumentParser::tryParse reports unknown options", Unknown.Code == UNRECOGNIZED_OPTION && Unknown.Position == 3);
+
+    const char *Cluster[] = {"parse_test", "-ac", "yes", "-abno"};
+    Parser.parse(4, Cluster, Result);
+    expectTrue("ParseResult counts clustered options", Result.getCount(0) == 2 && Result.getValuesCount(1) == 1 && Result.getValuesCount(2) == 1);
+
+    Parser.setAbbreviationsEnabled();
+    const char *Abbreviated[] = {"parse_test", "--alp", "--gam", "on", "--b"};
+    Parser.parse(5, Abbreviated, Result);
+    expectTrue("ParseResult counts abbreviated options", Result.getCount(0) == 1 && Result.getCount(1) == 1 && Result.getValuesCount(2) == 1);
+
+    //* Subcommands
+    size_t Built = 0;
+    for (size_t i = 0; i < 100; ++i) {
+        Parser.addSubcommand("cmd" + to_string(i), [&Built, &Outputs](ArgumentParser &Command) {
+            ++Built;
+            Command.addArgument(BooleanArg(Outputs[3], {"-a", "--all"}));
+        });
+    }
+    const char *WithSubcommand[] = {"parse_test", "-a", "cmd42", "--all"};
+    Parser.parse(4, WithSubcommand, Result);
+    Parser.parse(4, WithSubcommand, Result);
+    expectTrue("Subcommands are built lazily", Built == 1 && Result.getSubcommandResult().getCount(0) == 1);
+
+    //* Positional arguments
+    vector<string> Sources, Destination;
+    ArgumentParser Copying;
+    Copying.addArgument(ListArg(Sources, {"sources"}, "", NARGS::ONE_AND_MORE));
+    Copying.addArgument(ListArg(Destination, {"destination"}));
+    Copying.addArgument(BooleanArg(Outputs[4], {"-v"}));
+    const char *Files[] = {"parse_test", "a", "-v", "b", "c", "dir"};
+    Copying.parse(6, Files, Result);
+    expectTrue(
+        "ArgumentParser::tryParse distributes positional values",
+        Result.getValuesCount(Copying.indexOf("sources")) == 3 && Result.getValuesCount(Copying.indexOf("destination")) == 1
+    );
+
+    //* Response files
+    FILE *Response = fopen("parse_test.rsp", "w");
+    fputs("--name 'single quoted'\n\"double \\\"quoted\\\" \\\\\"\tplain\\ space @parse_test_nested.rsp", Response);
+    fclose(Response);
+    Response = fopen("parse_test_nested.rsp", "w");
+    fputs("  nested  \n", Response);
+    fclose(Response);
+    Response = fopen("parse_test_loop.rsp", "w");
+    fputs("@parse_test_loop.rsp", Response);
+    fclose(Response);
+    Response = fopen("parse_test_quote.rsp", "w");
+    fputs("'unterminated", Response);
+    fclose(Response);
+
+    vector<string> Names, Paths;
+    ArgumentParser Responding;
+    Responding.addArgument(ListArg(Names, {"--name"}));
+    Responding.addArgument(ListArg(Paths, {"paths"}, "", NARGS::ZERO_AND_MORE));
+    Responding.setResponseFilesEnabled();
+    const char *WithResponse[] = {"parse_test", "@parse_test.rsp", "last"};
+    Responding.parse(3, WithResponse);
+    expectTrue("Response files unquote arguments", Names.size() == 1 && Names[0] == "single quoted");
+    expectTrue(
+        "Response files read nested response files",
+        Paths.size() == 4 && Paths[0] == "double \"quoted\" \\" && Paths[1] == "plain space" &&
+        Paths[2] == "nested" && Paths[3] == "last"
+    );
+
+    const char *Looped[] = {"parse_test", "@parse_test_loop.rsp"};
+    const char *Missing[] = {"parse_test", "@parse_test_missing.rsp"};
+    const char *Unterminated[] = {"parse_test", "@parse_test_quote.rsp"};
+    expectTrue("Response files are nested at most RESPONSE_FILES_DEPTH deep", Responding.tryParse(2, Looped, Result).Code == RESPONSE_FILE_DEPTH);
+    expectTrue("Response files must be readable", Responding.tryParse(2, Missing, Result).Code == RESPONSE_FILE_UNREADABLE);
+    expectTrue("Response files reject unterminated quotes", Responding.tryParse(2, Unterminated, Result).Code == RESPONSE_FILE_QUOTE);
+
+    const char *Ended[] = {"parse_test", "--", "@parse_test_missing.rsp"};
+    Responding.parse(3, Ended);
+    expectTrue("Response files aren't expanded after \"--\"", Paths.size() == 1 && Paths[0] == "@parse_test_missing.rsp");
+
+    remove("parse_test.rsp");
+    remove("parse_test_nested.rsp");
+    remove("parse_test_loop.rsp");
+    remove("parse_test_quote.rsp");
+
+    return test_common::finish();
+}
@@ -0,0 +1,80 @@
+/**
+ * @file sources_test.cpp
+ * @brief Behavior of values read from the environment and config files
+ *
+ * @version 1.0.0
+ * @authors Eugene Azimut
+ * @copyright Copyright (c) Eugene Azimut, 2026
+ */
+#include <argparse/argparse.hpp>
+
+#include <test_common/checks.hpp>
+
+#include <cstdio>
+#include <stdexcept>
+
+using namespace argparse;
+using namespace argparse::args;
+using test_common::expectTrue;
+
+
+
+int main() {
+    bool Outputs[8] = {};
+    ParseResult Result;
+
+    ArgumentParser Parser;
+    Parser.addArgument(BooleanArg(Outputs[0], {"-a", "--alpha"}));
+    Parser.addArgument(BooleanArg(Outputs[1], {"-b", "--beta"}, "", NARGS::ZERO_OR_ONE));
+    Parser.addArgument(BooleanArg(Outputs[2], {"-c", "--gamma"}, "", 1));
+
+    //* Environment
+    Parser.addArgument(BooleanArg(Outputs[3], {"--delta"}, "", NARGS::ZERO_OR_ONE)).setEnvVar("SOURCES_TEST_DELTA");
+    test_common::setEnv("SOURCES_TEST_DELTA", "yes");
+    const char *WithoutDelta[] = {"sources_test", "-a"};
+    Parser.parse(2, WithoutDelta, Result);
+    expectTrue("ParseResult records environment variables", Result.getCount(3) == 1 && Result.getValuesCount(3) == 1);
+    Parser.parse(2, WithoutDelta);
+    expectTrue("ArgumentParser::parse applies environment variables", Outputs[3]);
+
+    test_common::setEnv("SOURCES_TEST_DELTA", "maybe");
+    const ArgparseError DeltaError = Parser.tryParse(2, WithoutDelta, Result);
+    test_common::setEnv("SOURCES_TEST_DELTA", "yes");
+    expectTrue(
+        "Invalid value of environment variable is rejected",
+        DeltaError.Code == INVALID_VALUE && DeltaError.Position == 0 && DeltaError.Arg == "SOURCES_TEST_DELTA=maybe"
+    );
+
+    bool IsRejected = false;
+    BooleanArg Quiet(Outputs[4], {"--quiet"});
+    try {
+        Quiet.setEnvVar("SOURCES_TEST_QUIET");
+    } catch (const std::invalid_argument &) {
+        IsRejected = true;
+    }
+    BooleanArg Verbose(Outputs[5], {"--verbose"}, "", NARGS::ZERO_OR_ONE);
+    Verbose.setEnvVar("SOURCES_TEST_VERBOSE");
+    try {
+        Verbose.setNArgs(NARGS::NO_MORE);
+        IsRejected = false;
+    } catch (const std::invalid_argument &) {}
+    expectTrue(
+        "Environment variable of option without values is rejected",
+        IsRejected && Quiet.getEnvVar().empty() && Verbose.getNArgs() == NARGS::ZERO_OR_ONE
+    );
+
+    //* Config file
+    FILE *Config = fopen("sources_test.ini", "w");
+    for (size_t i = 0; i < 1000; ++i) fputs("# options\nalpha\ngamma = on\n", Config);
+    fclose(Config);
+    Parser.setConfigFile("sources_test.ini");
+    const char *WithBeta[] = {"sources_test", "--beta"};
+    Parser.parse(2, WithBeta, Result);
+    expectTrue("ParseResult records config file", Result.getCount(0) == 1000 && Result.getValuesCount(2) == 1000 && Result.getCount(1) == 1);
+    remove("sources_test.ini");
+    expectTrue("Missing config file is skipped", !Parser.tryParse(2, WithBeta, Result));
+    Parser.setConfigFile(".");
+    expectTrue("Unreadable config file is rejected", Parser.tryParse(2, WithBeta, Result).Code == CONFIG_FILE_UNREADABLE);
+
+    return test_common::finish();
+}
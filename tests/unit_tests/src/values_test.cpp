@@ -0,0 +1,200 @@
+/**
+ * @file values_test.cpp
+ * @brief Behavior of value conversions of typed arguments
+ *
+ * @version 1.0.0
+ * @authors Eugene Azimut
+ * @copyright Copyright (c) Eugene Azimut, 2026
+ */
+#include <argparse/argparse.hpp>
+
+#include <test_common/checks.hpp>
+
+#include <cstdint>
+#include <stdexcept>
+#include <string>
+#include <utility>
+#include <vector>
+
+using namespace std;
+using namespace argparse;
+using namespace argparse::args;
+using test_common::expectTrue;
+
+
+
+namespace {
+    /**
+     * @brief Checks that every parsing path rejects Value of Flag with Code at its position
+     */
+    bool isRejected(ArgumentParser &Parser, const char *Flag, const char *Value, ErrorCode Code) {
+        const char *Args[] = {"values_test", Flag, Value};
+        ParseResult Result;
+        const ArgparseError Applied  = Parser.tryParse(3, Args);
+        const ArgparseError Recorded = Parser.tryParse(3, Args, Result);
+        const ArgparseError Compiled = Parser.compile().tryParse(3, Args, Result);
+        for (const ArgparseError &Error: {Applied, Recorded, Compiled}) {
+            if (Error.Code != Code || Error.Position != 2 || Error.Arg != Value) return false;
+        }
+        return true;
+    }
+
+    /**
+     * @brief Returns message of exception thrown by IArgument::applyValue, empty if nothing is thrown
+     */
+    string applyError(IArgument &Argument, const StringView &Value) {
+        try {
+            Argument.applyValue(Value);
+        } catch (const runtime_error &Error) {
+            return Error.what();
+        }
+        return string();
+    }
+}
+
+
+
+int main() {
+    //* Numbers
+    int Integer = 0;
+    double Double = 0;
+    IntegerArg IntegerOpt(Integer, {"-n"});
+    DoubleArg DoubleOpt(Double, {"-d"});
+    IntegerOpt.applyValue("-0x7fff");
+    DoubleOpt.applyValue("1.5e-3");
+    DoubleOpt.applyValue("2.2250738585072011e-308");
+    expectTrue("NumericArg converts values", Integer == -0x7fff && Double == 2.2250738585072011e-308);
+
+    unsigned Unsigned = 0;
+    ArgumentParser Numbers;
+    Numbers.addArgument(IntegerArg(Integer, {"-n"}));
+    UnsignedArg &UnsignedOpt = Numbers.addArgument(UnsignedArg(Unsigned, {"-u"}));
+    Numbers.addArgument(DoubleArg(Double, {"-d"}));
+    Numbers.addArgument(IntegerArg(Integer, {"-p"})).setRange(1, 65535);
+    expectTrue(
+        "NumericArg rejects overflow",
+        isRejected(Numbers, "-n", "2147483648", VALUE_OUT_OF_RANGE) && isRejected(Numbers, "-n", "-2147483649", VALUE_OUT_OF_RANGE) &&
+        isRejected(Numbers, "-u", "4294967296", VALUE_OUT_OF_RANGE)
+    );
+    expectTrue("NumericArg rejects negative unsigned values", isRejected(Numbers, "-u", "-1", VALUE_OUT_OF_RANGE));
+    expectTrue(
+        "NumericArg rejects values out of setRange",
+        isRejected(Numbers, "-p", "0", VALUE_OUT_OF_RANGE) && isRejected(Numbers, "-p", "65536", VALUE_OUT_OF_RANGE)
+    );
+    expectTrue(
+        "NumericArg rejects trailing garbage",
+        isRejected(Numbers, "-n", "12abc", INVALID_VALUE) && isRejected(Numbers, "-d", "1.5x", INVALID_VALUE) &&
+        isRejected(Numbers, "-n", "99999999999999999999x", INVALID_VALUE)
+    );
+    expectTrue("NumericArg rejects infinite doubles", isRejected(Numbers, "-d", "1e400", VALUE_OUT_OF_RANGE));
+    expectTrue(
+        "NumericArg::applyValue reports rejected values",
+        applyError(UnsignedOpt, "4294967296") ==
+            "argparse::NumericArg::applyValue(const StringView &): number doesn't fit the argument type - 4294967296" &&
+        applyError(UnsignedOpt, "12abc") == "argparse::NumericArg::applyValue(const StringView &): invalid number - 12abc"
+    );
+    UnsignedOpt.setRange(1, 10);
+    expectTrue(
+        "NumericArg::applyValue reports values out of setRange",
+        applyError(UnsignedOpt, "0") == "argparse::NumericArg::applyValue(const StringView &): number is less than 1 - 0" &&
+        applyError(UnsignedOpt, "11") == "argparse::NumericArg::applyValue(const StringView &): number is greater than 10 - 11"
+    );
+    expectTrue("Rejected values leave output variables untouched", Integer == -0x7fff && Unsigned == 0);
+
+    //* Sizes and durations
+    uint64_t Size = 0, Duration = 0;
+    SizeArg SizeOpt(Size, {"-s"});
+    DurationArg DurationOpt(Duration, {"-t"});
+    SizeOpt.applyValue("1.5GiB");
+    DurationOpt.applyValue("2h30m15.5s");
+    expectTrue("SizeArg and DurationArg convert values", Size == (UINT64_C(3) << 29) && Duration == UINT64_C(9015500000000));
+
+    SizeOpt.applyValue("1.5G");
+    const bool IsExact = Size == UINT64_C(1610612736);
+    SizeOpt.applyValue("1.0000000001G");
+    const bool IsTruncated = Size == (UINT64_C(1) << 30);
+    SizeOpt.applyValue("0.1K");
+    expectTrue("SizeArg truncates fractional bytes", IsExact && IsTruncated && Size == 102);
+
+    ArgumentParser Quantities;
+    Quantities.addArgument(SizeArg(Size, {"-s"}));
+    Quantities.addArgument(DurationArg(Duration, {"-t"}));
+    expectTrue(
+        "SizeArg rejects invalid sizes",
+        isRejected(Quantities, "-s", "10XB", INVALID_VALUE) && isRejected(Quantities, "-s", "k", INVALID_VALUE) &&
+        isRejected(Quantities, "-s", "99999999999999999999G", VALUE_OUT_OF_RANGE)
+    );
+    expectTrue(
+        "DurationArg rejects invalid durations",
+        isRejected(Quantities, "-t", "5H", INVALID_VALUE) && isRejected(Quantities, "-t", "h", INVALID_VALUE) &&
+        isRejected(Quantities, "-t", "600000d", VALUE_OUT_OF_RANGE)
+    );
+    expectTrue(
+        "SizeArg::applyValue reports rejected values",
+        applyError(SizeOpt, "10XB") == "argparse::SizeArg::applyValue(const StringView &): unknown size unit - 10XB" &&
+        applyError(SizeOpt, "k") == "argparse::SizeArg::applyValue(const StringView &): invalid size - k" &&
+        applyError(SizeOpt, "99999999999999999999G") ==
+            "argparse::SizeArg::applyValue(const StringView &): size doesn't fit 64 bits - 99999999999999999999G"
+    );
+    expectTrue(
+        "DurationArg::applyValue reports rejected values",
+        applyError(DurationOpt, "5H") ==
+            "argparse::DurationArg::applyValue(const StringView &): missing or unknown duration unit - 5H"
+    );
+    expectTrue("Rejected sizes and durations leave output variables untouched", Size == 102 && Duration == UINT64_C(9015500000000));
+
+    //* Choices
+    int Codec = 0;
+    ChoiceArg CodecOpt(Codec, {"--compression"}, {{"none", 0}, {"lz4", 1}, {"zstd", 2}});
+    CodecOpt.applyValue("zstd");
+    expectTrue("ChoiceArg resolves values", Codec == 2 && CodecOpt.find("zst") == ChoiceArg::NOT_FOUND);
+
+    ArgumentParser Choices;
+    Choices.addArgument(CodecOpt);
+    expectTrue("ChoiceArg rejects invalid choices", isRejected(Choices, "--compression", "zst", INVALID_VALUE));
+    expectTrue(
+        "ChoiceArg::applyValue reports invalid choices",
+        applyError(CodecOpt, "zst") ==
+            "argparse::ChoiceArg::applyValue(const StringView &): invalid choice - zst (choose from none, lz4, zstd)"
+    );
+
+    // These names have the same FNV-1a hash with salt 0: build() can't place both without changing salt
+    const string Colliding = "c5bde799c2362419", Collider = "a1a9a9bf38687075";
+    vector<pair<string, int>> Names;
+    for (int i = 0; i < 98; ++i) Names.push_back({"choice" + to_string(i), i});
+    Names.push_back({Colliding, 98});
+    Names.push_back({Collider, 99});
+    int Index = -1;
+    ChoiceArg Salted(Index, {"--salted"}, Names);
+    bool IsResolved = true;
+    for (const pair<string, int> &Name: Names) {
+        Salted.applyValue(Name.first);
+        IsResolved = IsResolved && Salted.find(Name.first) == static_cast<uint32_t>(Name.second) && Index == Name.second;
+    }
+    expectTrue("ChoiceArg resolves every name of colliding set", IsResolved);
+
+    // Without its pair, the collider lands on the slot of the colliding name and only comparison rejects it
+    Names.back().first = "choice98";
+    ArgumentParser Colliders;
+    ChoiceArg &Unsalted = Colliders.addArgument(ChoiceArg(Index, {"--unsalted"}, Names));
+    expectTrue(
+        "ChoiceArg rejects non-member with colliding slot",
+        Unsalted.find(Colliding) == 98 && Unsalted.find(Collider) == ChoiceArg::NOT_FOUND &&
+        isRejected(Colliders, "--unsalted", Collider.c_str(), INVALID_VALUE)
+    );
+
+    //* Lists
+    const size_t HostsCount = 1000;
+    string Hosts;
+    for (size_t i = 0; i < HostsCount; ++i) {
+        if (i) Hosts += ',';
+        Hosts += "h" + to_string(i);
+    }
+    vector<string> HostsList;
+    ListArg HostsOpt(HostsList, {"--hosts"}, "", 1, false, false, ',');
+    HostsOpt.applyDefault();
+    HostsOpt.applyValue(Hosts);
+    expectTrue("ListArg splits values", HostsList.size() == HostsCount && HostsList.back() == "h999");
+
+    return test_common::finish();
+}